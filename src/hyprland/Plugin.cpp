@@ -25,18 +25,12 @@
 #include "interfaces/HyprlandWindowProvider.h"
 #include <hyprland/src/Compositor.hpp>
 #include <hyprland/src/helpers/Monitor.hpp>
-#include <hyprland/src/managers/eventLoop/EventLoopManager.hpp>
 #include <libinputactions/Config.h>
 #include <libinputactions/variables/VariableManager.h>
 #undef HANDLE
 
-#include <QCoreApplication>
-#include <chrono>
-
 using namespace libinputactions;
 
-static const auto TICK_INTERVAL = std::chrono::milliseconds(static_cast<uint32_t>(1));
-
 Plugin::Plugin(void *handle)
     : InputActions(std::make_unique<HyprlandInputBackend>(handle))
 {
@@ -55,19 +49,5 @@ Plugin::Plugin(void *handle)
         }
     });
 
-    m_eventLoopTimer = makeShared<CEventLoopTimer>(
-        TICK_INTERVAL,
-        [this](SP<CEventLoopTimer> self, void *data) {
-            tick();
-        },
-        this);
-    g_pEventLoopManager->addTimer(m_eventLoopTimer);
-
     g_config->load(true);
-}
-
-void Plugin::tick()
-{
-    QCoreApplication::processEvents();
-    m_eventLoopTimer->updateTimeout(TICK_INTERVAL);
 }
\ No newline at end of file
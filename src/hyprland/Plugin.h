@@ -18,16 +18,10 @@
 
 #pragma once
 
-#include <hyprland/src/managers/eventLoop/EventLoopTimer.hpp>
 #include <libinputactions/InputActions.h>
 
 class Plugin : public libinputactions::InputActions
 {
 public:
     Plugin(void *handle);
-
-private:
-    void tick();
-
-    SP<CEventLoopTimer> m_eventLoopTimer;
 };
\ No newline at end of file
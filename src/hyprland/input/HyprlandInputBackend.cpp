@@ -18,12 +18,16 @@
 
 #include "HyprlandInputBackend.h"
 #include "Plugin.h"
+#include <aquamarine/backend/Backend.hpp>
 #include <aquamarine/input/Input.hpp>
+#include <hyprland/src/Compositor.hpp>
 #include <hyprland/src/devices/IKeyboard.hpp>
 #include <hyprland/src/devices/IPointer.hpp>
 #include <hyprland/src/managers/SeatManager.hpp>
 #include <hyprland/src/managers/input/InputManager.hpp>
 #include <hyprland/src/plugins/PluginAPI.hpp>
+#include <hyprland/src/protocols/VirtualKeyboard.hpp>
+#include <hyprland/src/protocols/VirtualPointer.hpp>
 #undef HANDLE
 #include <libinputactions/input/InputDevice.h>
 
@@ -35,6 +39,33 @@ typedef void (*pinchBegin)(void *thisPtr, uint32_t timeMs, uint32_t fingers);
 typedef void (*pinchUpdate)(void *thisPtr, uint32_t timeMs, const Vector2D &delta, double scale, double rotation);
 typedef void (*pinchEnd)(void *thisPtr, uint32_t timeMs, bool cancelled);
 
+/**
+ * Converts a 32-bit libinput millisecond timestamp, which wraps around every ~49 days, to a full CLOCK_MONOTONIC timestamp.
+ */
+static std::chrono::microseconds timestamp(uint32_t timeMs)
+{
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    auto time = (now & ~static_cast<int64_t>(UINT32_MAX)) | timeMs;
+    if (time > now) {
+        time -= static_cast<int64_t>(UINT32_MAX) + 1;
+    }
+    return std::chrono::milliseconds(time);
+}
+
+/**
+ * @return The value of the specified key of a callback payload, or nullptr if the key is missing or the value has a different type.
+ */
+template<typename T>
+static const T *payloadValue(const std::any &data, const std::string &key)
+{
+    const auto *map = std::any_cast<std::unordered_map<std::string, std::any>>(&data);
+    if (!map) {
+        return nullptr;
+    }
+    const auto it = map->find(key);
+    return it == map->end() ? nullptr : std::any_cast<T>(&it->second);
+}
+
 HyprlandInputBackend::HyprlandInputBackend(void *handle)
     : m_holdBeginHook(handle, "holdBegin", (void *)&holdBeginHook)
     , m_holdEndHook(handle, "holdEnd", (void *)&holdEndHook)
@@ -42,6 +73,8 @@ HyprlandInputBackend::HyprlandInputBackend(void *handle)
     , m_pinchUpdateHook(handle, "pinchUpdate", (void *)pinchUpdateHook)
     , m_pinchEndHook(handle, "pinchEnd", (void *)&pinchEndHook)
 {
+    s_instance = this;
+
     m_events.push_back(HyprlandAPI::registerCallbackDynamic(handle, "keyPress", [this](void *, SCallbackInfo &info, std::any data) {
         keyboardKey(info, data);
     }));
@@ -64,209 +97,235 @@ HyprlandInputBackend::HyprlandInputBackend(void *handle)
         touchpadSwipeEnd(info, data);
     }));
 
-    connect(&m_deviceChangeTimer, &QTimer::timeout, this, &HyprlandInputBackend::checkDeviceChanges);
-    m_deviceChangeTimer.setInterval(1000);
-    m_deviceChangeTimer.start();
+    // Hyprland's listeners are registered first, so the devices have already been added to the input manager. Virtual devices created through the
+    // virtual-keyboard and virtual-pointer protocols are not announced by the backend.
+    auto &backendEvents = g_pCompositor->m_aqBackend->events;
+    for (auto *hyprlandSignal : {&backendEvents.newKeyboard,
+                                 &backendEvents.newPointer,
+                                 &PROTO::virtualKeyboard->m_events.newKeyboard,
+                                 &PROTO::virtualPointer->m_events.newPointer}) {
+        m_backendListeners.push_back(hyprlandSignal->registerListener([this](const std::any &) {
+            initialize();
+        }));
+    }
 }
 
 HyprlandInputBackend::~HyprlandInputBackend()
 {
-    reset();
+    s_instance = nullptr;
+    for (auto &[_, device] : m_devices) {
+        removeDevice(device.libinputactionsDevice.get());
+    }
 }
 
 void HyprlandInputBackend::initialize()
 {
-    checkDeviceChanges();
+    for (const auto &device : g_pInputManager->m_hids) {
+        hyprlandDeviceAdded(device.get());
+    }
 }
 
-void HyprlandInputBackend::reset()
+void HyprlandInputBackend::hyprlandDeviceAdded(IHID *hyprlandDevice)
 {
-    for (auto &device : m_devices) {
-        deviceRemoved(device.libinputactionsDevice.get());
+    if (m_devices.contains(hyprlandDevice)) {
+        return;
     }
-    m_devices.clear();
-    m_hyprlandDevices.clear();
-    LibinputCompositorInputBackend::reset();
-}
 
-void HyprlandInputBackend::checkDeviceChanges()
-{
-    auto &devices = g_pInputManager->m_hids;
-    for (auto &device : devices) {
-        if (std::ranges::any_of(m_hyprlandDevices, [&device](const auto &existingDevice) {
-                return existingDevice == device.get();
-            })) {
-            continue;
-        }
+    InputDeviceType type;
+    QString name;
+    auto *keyboard = dynamic_cast<IKeyboard *>(hyprlandDevice);
+    auto *pointer = keyboard ? nullptr : dynamic_cast<IPointer *>(hyprlandDevice);
+    if (keyboard) {
+        type = InputDeviceType::Keyboard;
+        name = QString::fromStdString(keyboard->m_deviceName);
+    } else if (pointer) {
+        type = pointer->m_isTouchpad ? InputDeviceType::Touchpad : InputDeviceType::Mouse;
+        name = QString::fromStdString(pointer->m_deviceName);
+    } else {
+        return;
+    }
 
-        HyprlandInputDevice newDevice{
-            .hyprlandDevice = device.get(),
-        };
-        InputDeviceType type;
-        QString name;
-        if (auto *keyboard = dynamic_cast<IKeyboard *>(device.get())) {
-            type = InputDeviceType::Keyboard;
-            name = QString::fromStdString(keyboard->m_deviceName);
-        } else if (auto *pointer = dynamic_cast<IPointer *>(device.get())) {
-            type = pointer->m_isTouchpad ? InputDeviceType::Touchpad : InputDeviceType::Mouse;
-            name = QString::fromStdString(pointer->m_deviceName);
-
-            // Not all events provide the device, so it is instead obtained by listening to events of all devices. Those listeners are executed after the event
-            // is handled by the backend, so the first libinputactions event after launching the compositor will have a null sender and after changing the
-            // input device it will have the previous one of the same type.
-            auto &events = pointer->m_pointerEvents;
-            if (pointer->m_isTouchpad) {
-                for (auto *hyprlandSignal : {&events.axis, &events.button, &events.motion, &events.holdBegin, &events.pinchBegin, &events.swipeBegin}) {
-                    newDevice.listeners.push_back(hyprlandSignal->registerListener([this, device](const std::any &) {
-                        if (auto *foundDevice = findDevice(device.get())) {
-                            m_currentPointingDevice = foundDevice->libinputactionsDevice.get();
-                            m_currentTouchpad = m_currentPointingDevice;
-                        }
-                    }));
-                }
-            } else {
-                for (auto *hyprlandSignal : {&events.axis, &events.button, &events.motion}) {
-                    newDevice.listeners.push_back(hyprlandSignal->registerListener([this, device](const std::any &) {
-                        if (auto *foundDevice = findDevice(device.get())) {
-                            m_currentPointingDevice = foundDevice->libinputactionsDevice.get();
-                        }
-                    }));
-                }
+    HyprlandInputDevice newDevice{
+        .hyprlandDevice = hyprlandDevice,
+        .libinputactionsDevice = std::make_unique<InputDevice>(type, name),
+    };
+    auto *device = newDevice.libinputactionsDevice.get();
+    if (pointer) {
+        // Not all events provide the device, so it is instead obtained by listening to events of all devices. Those listeners are executed after the event
+        // is handled by the backend, so the first libinputactions event after launching the compositor will have a null sender and after changing the
+        // input device it will have the previous one of the same type.
+        auto &events = pointer->m_pointerEvents;
+        if (pointer->m_isTouchpad) {
+            for (auto *hyprlandSignal : {&events.axis, &events.button, &events.motion, &events.holdBegin, &events.pinchBegin, &events.swipeBegin}) {
+                newDevice.listeners.push_back(hyprlandSignal->registerListener([this, device](const std::any &) {
+                    m_currentPointingDevice = device;
+                    m_currentTouchpad = device;
+                }));
             }
         } else {
-            continue;
+            for (auto *hyprlandSignal : {&events.axis, &events.button, &events.motion}) {
+                newDevice.listeners.push_back(hyprlandSignal->registerListener([this, device](const std::any &) {
+                    m_currentPointingDevice = device;
+                }));
+            }
         }
+    }
+    newDevice.listeners.push_back(hyprlandDevice->m_events.destroy.registerListener([this, hyprlandDevice](const std::any &) {
+        hyprlandDeviceRemoved(hyprlandDevice);
+    }));
+
+    addDevice(device);
+    m_devices[hyprlandDevice] = std::move(newDevice);
+}
 
-        newDevice.libinputactionsDevice = std::make_unique<InputDevice>(type, name);
-        deviceAdded(newDevice.libinputactionsDevice.get());
-        m_devices.push_back(std::move(newDevice));
-        m_hyprlandDevices.push_back(device.get());
+void HyprlandInputBackend::hyprlandDeviceRemoved(IHID *hyprlandDevice)
+{
+    const auto it = m_devices.find(hyprlandDevice);
+    if (it == m_devices.end()) {
+        return;
     }
 
-    for (auto it = m_devices.begin(); it != m_devices.end();) {
-        if (!std::ranges::any_of(m_hyprlandDevices, [it](const auto &device) {
-                return device == it->hyprlandDevice;
-            })) {
-            deviceRemoved(it->libinputactionsDevice.get());
-            std::erase(m_hyprlandDevices, it->hyprlandDevice);
-            it = m_devices.erase(it);
-            continue;
-        }
-        it++;
+    auto *device = it->second.libinputactionsDevice.get();
+    if (m_currentPointingDevice == device) {
+        m_currentPointingDevice = nullptr;
+    }
+    if (m_currentTouchpad == device) {
+        m_currentTouchpad = nullptr;
     }
+    removeDevice(device);
+    // The listener that called this method is owned by the device, destroy it after the signal has been emitted
+    QMetaObject::invokeMethod(this, [removedDevice = std::make_shared<HyprlandInputDevice>(std::move(it->second))] {}, Qt::QueuedConnection);
+    m_devices.erase(it);
 }
 
 void HyprlandInputBackend::keyboardKey(SCallbackInfo &info, const std::any &data)
 {
-    const auto map = std::any_cast<std::unordered_map<std::string, std::any>>(data);
-    const auto event = std::any_cast<IKeyboard::SKeyEvent>(map.at("event"));
-    const auto keyboard = std::any_cast<SP<IKeyboard>>(map.at("keyboard"));
-    info.cancelled = LibinputCompositorInputBackend::keyboardKey(findInputActionsDevice(keyboard.get()),
-                                                                 event.keycode,
-                                                                 event.state == WL_KEYBOARD_KEY_STATE_PRESSED);
+    const auto *event = payloadValue<IKeyboard::SKeyEvent>(data, "event");
+    const auto *keyboard = payloadValue<SP<IKeyboard>>(data, "keyboard");
+    if (!event || !keyboard) {
+        return;
+    }
+
+    info.cancelled = LibinputCompositorInputBackend::keyboardKey(findInputActionsDevice(keyboard->get()),
+                                                                 event->keycode,
+                                                                 event->state == WL_KEYBOARD_KEY_STATE_PRESSED,
+                                                                 timestamp(event->timeMs));
 }
 
 void HyprlandInputBackend::pointerAxis(SCallbackInfo &info, const std::any &data)
 {
-    const auto map = std::any_cast<std::unordered_map<std::string, std::any>>(data);
-    const auto event = std::any_cast<IPointer::SAxisEvent>(map.at("event"));
+    const auto *event = payloadValue<IPointer::SAxisEvent>(data, "event");
+    if (!event) {
+        return;
+    }
 
-    auto delta = event.axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL ? QPointF(event.delta, 0) : QPointF(0, event.delta);
-    if (event.relativeDirection == WL_POINTER_AXIS_RELATIVE_DIRECTION_INVERTED) {
+    auto delta = event->axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL ? QPointF(event->delta, 0) : QPointF(0, event->delta);
+    if (event->relativeDirection == WL_POINTER_AXIS_RELATIVE_DIRECTION_INVERTED) {
         delta *= -1;
     }
-    info.cancelled = LibinputCompositorInputBackend::pointerAxis(m_currentPointingDevice, delta);
+    info.cancelled = LibinputCompositorInputBackend::pointerAxis(m_currentPointingDevice, delta, timestamp(event->timeMs));
 }
 
 void HyprlandInputBackend::pointerButton(SCallbackInfo &info, const std::any &data)
 {
-    const auto event = std::any_cast<IPointer::SButtonEvent>(data);
+    const auto *event = std::any_cast<IPointer::SButtonEvent>(&data);
+    if (!event) {
+        return;
+    }
+
     info.cancelled = LibinputCompositorInputBackend::pointerButton(m_currentPointingDevice,
-                                                                   scanCodeToMouseButton(event.button),
-                                                                   event.button,
-                                                                   event.state == WL_POINTER_BUTTON_STATE_PRESSED);
+                                                                   scanCodeToMouseButton(event->button),
+                                                                   event->button,
+                                                                   event->state == WL_POINTER_BUTTON_STATE_PRESSED,
+                                                                   timestamp(event->timeMs));
 }
 
 void HyprlandInputBackend::pointerMotion(SCallbackInfo &info, const std::any &data)
 {
-    const auto pointerPosition = std::any_cast<const Vector2D>(data);
-    const auto delta = pointerPosition - m_previousPointerPosition;
-    m_previousPointerPosition = pointerPosition;
+    const auto *pointerPosition = std::any_cast<Vector2D>(&data);
+    if (!pointerPosition) {
+        return;
+    }
+
+    const auto delta = *pointerPosition - m_previousPointerPosition;
+    m_previousPointerPosition = *pointerPosition;
     info.cancelled = LibinputCompositorInputBackend::pointerMotion(m_currentPointingDevice, QPointF(delta.x, delta.y));
 }
 
 void HyprlandInputBackend::holdBeginHook(void *thisPtr, uint32_t timeMs, uint32_t fingers)
 {
-    auto *self = dynamic_cast<HyprlandInputBackend *>(g_inputBackend.get());
-    if (!self->LibinputCompositorInputBackend::touchpadHoldBegin(self->m_currentTouchpad, fingers)) {
+    auto *self = s_instance;
+    if (!self->LibinputCompositorInputBackend::touchpadHoldBegin(self->m_currentTouchpad, fingers, timestamp(timeMs))) {
         (*(holdBegin)self->m_holdBeginHook->m_original)(thisPtr, timeMs, fingers);
     }
 }
 
 void HyprlandInputBackend::holdEndHook(void *thisPtr, uint32_t timeMs, bool cancelled)
 {
-    auto *self = dynamic_cast<HyprlandInputBackend *>(g_inputBackend.get());
-    if (!self->LibinputCompositorInputBackend::touchpadHoldEnd(self->m_currentTouchpad, cancelled)) {
+    auto *self = s_instance;
+    if (!self->LibinputCompositorInputBackend::touchpadHoldEnd(self->m_currentTouchpad, cancelled, timestamp(timeMs))) {
         (*(holdEnd)self->m_holdEndHook->m_original)(thisPtr, timeMs, cancelled);
     }
 }
 
 void HyprlandInputBackend::pinchBeginHook(void *thisPtr, uint32_t timeMs, uint32_t fingers)
 {
-    auto *self = dynamic_cast<HyprlandInputBackend *>(g_inputBackend.get());
-    if (!self->LibinputCompositorInputBackend::touchpadPinchBegin(self->m_currentTouchpad, fingers)) {
+    auto *self = s_instance;
+    if (!self->LibinputCompositorInputBackend::touchpadPinchBegin(self->m_currentTouchpad, fingers, timestamp(timeMs))) {
         (*(pinchBegin)self->m_pinchBeginHook->m_original)(thisPtr, timeMs, fingers);
     }
 }
 
 void HyprlandInputBackend::pinchUpdateHook(void *thisPtr, uint32_t timeMs, const Vector2D &delta, double scale, double rotation)
 {
-    auto *self = dynamic_cast<HyprlandInputBackend *>(g_inputBackend.get());
-    if (!self->LibinputCompositorInputBackend::touchpadPinchUpdate(self->m_currentTouchpad, scale, rotation)) {
+    auto *self = s_instance;
+    if (!self->LibinputCompositorInputBackend::touchpadPinchUpdate(self->m_currentTouchpad, scale, rotation, timestamp(timeMs))) {
         (*(pinchUpdate)self->m_pinchUpdateHook->m_original)(thisPtr, timeMs, delta, scale, rotation);
     }
 }
 
 void HyprlandInputBackend::pinchEndHook(void *thisPtr, uint32_t timeMs, bool cancelled)
 {
-    auto *self = dynamic_cast<HyprlandInputBackend *>(g_inputBackend.get());
-    if (!self->LibinputCompositorInputBackend::touchpadPinchEnd(self->m_currentTouchpad, cancelled)) {
+    auto *self = s_instance;
+    if (!self->LibinputCompositorInputBackend::touchpadPinchEnd(self->m_currentTouchpad, cancelled, timestamp(timeMs))) {
         (*(pinchEnd)self->m_pinchEndHook->m_original)(thisPtr, timeMs, cancelled);
     }
 }
 
 void HyprlandInputBackend::touchpadSwipeBegin(SCallbackInfo &info, const std::any &data)
 {
-    const auto event = std::any_cast<IPointer::SSwipeBeginEvent>(data);
-    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeBegin(m_currentTouchpad, event.fingers);
+    const auto *event = std::any_cast<IPointer::SSwipeBeginEvent>(&data);
+    if (!event) {
+        return;
+    }
+
+    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeBegin(m_currentTouchpad, event->fingers, timestamp(event->timeMs));
 }
 
 void HyprlandInputBackend::touchpadSwipeUpdate(SCallbackInfo &info, const std::any &data)
 {
-    const auto event = std::any_cast<IPointer::SSwipeUpdateEvent>(data);
-    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeUpdate(m_currentTouchpad, QPointF(event.delta.x, event.delta.y));
-}
+    const auto *event = std::any_cast<IPointer::SSwipeUpdateEvent>(&data);
+    if (!event) {
+        return;
+    }
 
-void HyprlandInputBackend::touchpadSwipeEnd(SCallbackInfo &info, const std::any &data)
-{
-    const auto event = std::any_cast<IPointer::SSwipeEndEvent>(data);
-    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeEnd(m_currentTouchpad, event.cancelled);
+    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeUpdate(m_currentTouchpad, QPointF(event->delta.x, event->delta.y), timestamp(event->timeMs));
 }
 
-HyprlandInputDevice *HyprlandInputBackend::findDevice(IHID *hyprlandDevice)
+void HyprlandInputBackend::touchpadSwipeEnd(SCallbackInfo &info, const std::any &data)
 {
-    for (auto &device : m_devices) {
-        if (device.hyprlandDevice == hyprlandDevice) {
-            return &device;
-        }
+    const auto *event = std::any_cast<IPointer::SSwipeEndEvent>(&data);
+    if (!event) {
+        return;
     }
-    return {};
+
+    info.cancelled = LibinputCompositorInputBackend::touchpadSwipeEnd(m_currentTouchpad, event->cancelled, timestamp(event->timeMs));
 }
 
 InputDevice *HyprlandInputBackend::findInputActionsDevice(IHID *hyprlandDevice)
 {
-    if (auto *device = findDevice(hyprlandDevice)) {
-        return device->libinputactionsDevice.get();
+    if (const auto it = m_devices.find(hyprlandDevice); it != m_devices.end()) {
+        return it->second.libinputactionsDevice.get();
     }
     return {};
 }
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <hyprland/src/plugins/HookSystem.hpp>
 #undef HANDLE
 #include <libinputactions/input/backends/LibinputCompositorInputBackend.h>
+#include <unordered_map>
 
 namespace libinputactions
 {
@@ -49,10 +50,10 @@ public:
     ~HyprlandInputBackend() override;
 
     void initialize() override;
-    void reset() override;
 
 private:
-    void checkDeviceChanges();
+    void hyprlandDeviceAdded(IHID *hyprlandDevice);
+    void hyprlandDeviceRemoved(IHID *hyprlandDevice);
 
     void keyboardKey(SCallbackInfo &info, const std::any &data);
 
@@ -71,17 +72,20 @@ private:
     void pointerButton(SCallbackInfo &info, const std::any &data);
     void pointerMotion(SCallbackInfo &info, const std::any &data);
 
-    HyprlandInputDevice *findDevice(IHID *hyprlandDevice);
     libinputactions::InputDevice *findInputActionsDevice(IHID *hyprlandDevice);
 
-    std::vector<SP<HOOK_CALLBACK_FN>> m_events;
+    /**
+     * Used by function hooks, which are not given the instance.
+     */
+    inline static HyprlandInputBackend *s_instance{};
 
+    std::vector<SP<HOOK_CALLBACK_FN>> m_events;
     /**
-     * Used to detect device changes.
+     * New device listeners.
      */
-    std::vector<IHID *> m_hyprlandDevices;
-    std::vector<HyprlandInputDevice> m_devices;
-    QTimer m_deviceChangeTimer;
+    std::vector<CHyprSignalListener> m_backendListeners;
+
+    std::unordered_map<IHID *, HyprlandInputDevice> m_devices;
 
     /**
      * Mouse or touchpad.
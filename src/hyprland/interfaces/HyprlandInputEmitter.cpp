@@ -41,7 +41,7 @@ HyprlandInputEmitter::~HyprlandInputEmitter()
 
 void HyprlandInputEmitter::keyboardClearModifiers()
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     m_modifiers = 0;
     const auto modifiers = g_keyboard->modifiers();
     for (auto &keyboard : g_pInputManager->m_keyboards) {
@@ -59,12 +59,12 @@ void HyprlandInputEmitter::keyboardClearModifiers()
             });
         }
     }
-    g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void HyprlandInputEmitter::keyboardKey(uint32_t key, bool state)
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     if (const auto modifier = g_pKeybindManager->keycodeToModifier(key + 8)) {
         if (state) {
             m_modifiers |= modifier;
@@ -80,44 +80,54 @@ void HyprlandInputEmitter::keyboardKey(uint32_t key, bool state)
         .key = key,
         .pressed = state,
     });
-    g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void HyprlandInputEmitter::mouseButton(uint32_t button, bool state)
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     g_pInputManager->onMouseButton(IPointer::SButtonEvent{
         .button = button,
         .state = state ? WL_POINTER_BUTTON_STATE_PRESSED : WL_POINTER_BUTTON_STATE_RELEASED,
     });
-    g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void HyprlandInputEmitter::mouseMoveRelative(const QPointF &pos)
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     const Vector2D delta(pos.x(), pos.y());
     g_pInputManager->onMouseMoved(IPointer::SMotionEvent{
         .delta = delta,
         .unaccel = delta,
         .device = m_pointer,
     });
-    g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void HyprlandInputEmitter::touchpadPinchBegin(uint8_t fingers)
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     PROTO::pointerGestures->pinchBegin(0, fingers);
-    g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void HyprlandInputEmitter::touchpadSwipeBegin(uint8_t fingers)
 {
-    g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     g_pInputManager->onSwipeBegin(IPointer::SSwipeBeginEvent{
         .fingers = fingers,
     });
+    commit();
+}
+
+void HyprlandInputEmitter::batchBegun()
+{
+    g_inputBackend->setIgnoreEvents(true);
+}
+
+void HyprlandInputEmitter::batchCommitted()
+{
     g_inputBackend->setIgnoreEvents(false);
 }
 
@@ -55,6 +55,10 @@ public:
     void touchpadPinchBegin(uint8_t fingers) override;
     void touchpadSwipeBegin(uint8_t fingers) override;
 
+protected:
+    void batchBegun() override;
+    void batchCommitted() override;
+
 private:
     uint32_t m_modifiers{};
     SP<Aquamarine::IKeyboard> m_keyboard;
@@ -1,13 +1,15 @@
 #include "Plugin.h"
+#include "utils/HyprlandEventDispatcher.h"
+#include <hyprland/src/Compositor.hpp>
 #include <hyprland/src/plugins/PluginAPI.hpp>
 #undef HANDLE
 
 #include <QCoreApplication>
 
-inline std::unique_ptr<Plugin> plugin;
-
 static int argc = 0;
-inline QCoreApplication app(argc, nullptr);
+inline std::unique_ptr<QCoreApplication> app;
+
+inline std::unique_ptr<Plugin> plugin;
 
 APICALL EXPORT std::string PLUGIN_API_VERSION()
 {
@@ -22,6 +24,9 @@ APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(void *handle)
         throw std::runtime_error("[" PROJECT_NAME "] Version mismatch");
     }
 
+    // Qt events are processed by the compositor's event loop
+    QCoreApplication::setEventDispatcher(new HyprlandEventDispatcher(g_pCompositor->m_wlEventLoop));
+    app = std::make_unique<QCoreApplication>(argc, nullptr);
     plugin = std::make_unique<Plugin>(handle);
     return {PROJECT_NAME, "Custom mouse and touchpad gestures for Hyprland", "taj_ny", PROJECT_VERSION};
 }
@@ -29,4 +34,5 @@ APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(void *handle)
 APICALL EXPORT void PLUGIN_EXIT()
 {
     plugin.reset();
+    app.reset();
 }
\ No newline at end of file
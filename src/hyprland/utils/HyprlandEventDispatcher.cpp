@@ -0,0 +1,290 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "HyprlandEventDispatcher.h"
+#include <QCoreApplication>
+#include <QSocketNotifier>
+#include <algorithm>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <wayland-server-core.h>
+
+static void activateSocketNotifier(QSocketNotifier *notifier)
+{
+    QEvent event(QEvent::SockAct);
+    QCoreApplication::sendEvent(notifier, &event);
+}
+
+HyprlandEventDispatcher::HyprlandEventDispatcher(wl_event_loop *loop)
+    : m_loop(loop)
+{
+    m_timerSource = wl_event_loop_add_timer(m_loop, handleTimer, this);
+    m_wakeUpFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    m_wakeUpSource = wl_event_loop_add_fd(m_loop, m_wakeUpFd, WL_EVENT_READABLE, handleWakeUp, this);
+}
+
+HyprlandEventDispatcher::~HyprlandEventDispatcher()
+{
+    removeSources();
+    close(m_wakeUpFd);
+}
+
+bool HyprlandEventDispatcher::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    m_interrupted = false;
+    sendPostedEvents();
+
+    bool handled{};
+    std::vector<pollfd> fds{{
+        .fd = m_wakeUpFd,
+        .events = POLLIN,
+    }};
+    std::vector<QSocketNotifier *> notifiers;
+    if (!flags.testFlag(QEventLoop::ExcludeSocketNotifiers)) {
+        for (const auto &[notifier, _] : m_socketNotifiers) {
+            fds.push_back({
+                .fd = static_cast<int>(notifier->socket()),
+                .events = static_cast<short>(notifier->type() == QSocketNotifier::Read ? POLLIN : (notifier->type() == QSocketNotifier::Write ? POLLOUT : POLLPRI)),
+            });
+            notifiers.push_back(notifier);
+        }
+    }
+
+    // Posted events sent above that post further events will have written to the wake up fd
+    const auto timeout = flags.testFlag(QEventLoop::WaitForMoreEvents) && !m_interrupted ? nextTimerTimeout() : 0;
+    if (poll(fds.data(), fds.size(), timeout) > 0) {
+        if (fds[0].revents) {
+            handleWakeUp(m_wakeUpFd, 0, this);
+            handled = true;
+        }
+        for (size_t i = 1; i < fds.size(); i++) {
+            // Notifiers may have been unregistered by previous ones
+            if (fds[i].revents && m_socketNotifiers.contains(notifiers[i - 1])) {
+                activateSocketNotifier(notifiers[i - 1]);
+                handled = true;
+            }
+        }
+    }
+    if (!flags.testFlag(QEventLoop::X11ExcludeTimers) && processTimers()) {
+        handled = true;
+    }
+    return handled;
+}
+
+void HyprlandEventDispatcher::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    uint32_t mask{};
+    switch (notifier->type()) {
+        case QSocketNotifier::Read:
+            mask = WL_EVENT_READABLE;
+            break;
+        case QSocketNotifier::Write:
+            mask = WL_EVENT_WRITABLE;
+            break;
+        case QSocketNotifier::Exception:
+            // Hangups and errors are always reported
+            break;
+    }
+    // The event loop duplicates the fd, so multiple notifiers for the same fd are fine
+    m_socketNotifiers[notifier] = wl_event_loop_add_fd(m_loop, static_cast<int>(notifier->socket()), mask, handleSocketNotifier, notifier);
+}
+
+void HyprlandEventDispatcher::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    if (const auto it = m_socketNotifiers.find(notifier); it != m_socketNotifiers.end()) {
+        if (it->second) {
+            wl_event_source_remove(it->second);
+        }
+        m_socketNotifiers.erase(it);
+    }
+}
+
+void HyprlandEventDispatcher::registerTimer(int timerId, qint64 interval, Qt::TimerType timerType, QObject *object)
+{
+    m_timers.push_back({
+        .id = timerId,
+        .interval = interval,
+        .type = timerType,
+        .object = object,
+        .deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(interval),
+    });
+    updateTimerSource();
+}
+
+bool HyprlandEventDispatcher::unregisterTimer(int timerId)
+{
+    if (!std::erase_if(m_timers, [timerId](const auto &timer) {
+            return timer.id == timerId;
+        })) {
+        return false;
+    }
+    updateTimerSource();
+    return true;
+}
+
+bool HyprlandEventDispatcher::unregisterTimers(QObject *object)
+{
+    if (!std::erase_if(m_timers, [object](const auto &timer) {
+            return timer.object == object;
+        })) {
+        return false;
+    }
+    updateTimerSource();
+    return true;
+}
+
+QList<QAbstractEventDispatcher::TimerInfo> HyprlandEventDispatcher::registeredTimers(QObject *object) const
+{
+    QList<TimerInfo> result;
+    for (const auto &timer : m_timers) {
+        if (timer.object == object) {
+            result.emplace_back(timer.id, static_cast<int>(timer.interval), timer.type);
+        }
+    }
+    return result;
+}
+
+int HyprlandEventDispatcher::remainingTime(int timerId)
+{
+    for (const auto &timer : m_timers) {
+        if (timer.id == timerId) {
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(timer.deadline - std::chrono::steady_clock::now());
+            return std::max(static_cast<int>(remaining.count()), 0);
+        }
+    }
+    return -1;
+}
+
+void HyprlandEventDispatcher::wakeUp()
+{
+    // May be called from any thread
+    const uint64_t value = 1;
+    write(m_wakeUpFd, &value, sizeof(value));
+}
+
+void HyprlandEventDispatcher::interrupt()
+{
+    m_interrupted = true;
+    wakeUp();
+}
+
+void HyprlandEventDispatcher::closingDown()
+{
+    removeSources();
+}
+
+void HyprlandEventDispatcher::sendPostedEvents()
+{
+    if (!QCoreApplication::instance()) {
+        return;
+    }
+
+    QCoreApplication::sendPostedEvents();
+    // There is no running QEventLoop, deferred deletions must be requested explicitly
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+bool HyprlandEventDispatcher::processTimers()
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<int> expiredTimers;
+    for (const auto &timer : m_timers) {
+        if (timer.deadline <= now) {
+            expiredTimers.push_back(timer.id);
+        }
+    }
+
+    for (const auto id : expiredTimers) {
+        // Timers may have been unregistered by previous ones
+        const auto it = std::ranges::find_if(m_timers, [id](const auto &timer) {
+            return timer.id == id;
+        });
+        if (it == m_timers.end()) {
+            continue;
+        }
+
+        it->deadline = now + std::chrono::milliseconds(it->interval);
+        auto *object = it->object;
+        QTimerEvent event(id);
+        QCoreApplication::sendEvent(object, &event);
+    }
+    updateTimerSource();
+    return !expiredTimers.empty();
+}
+
+void HyprlandEventDispatcher::updateTimerSource()
+{
+    if (!m_timerSource) {
+        return;
+    }
+
+    const auto timeout = nextTimerTimeout();
+    // 0 disarms the timer
+    wl_event_source_timer_update(m_timerSource, timeout == -1 ? 0 : std::max(timeout, 1));
+}
+
+int HyprlandEventDispatcher::nextTimerTimeout() const
+{
+    if (m_timers.empty()) {
+        return -1;
+    }
+
+    const auto deadline = std::ranges::min_element(m_timers, {}, &Timer::deadline)->deadline;
+    const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    return std::max(static_cast<int>(remaining.count()), 0);
+}
+
+void HyprlandEventDispatcher::removeSources()
+{
+    for (const auto &[_, source] : m_socketNotifiers) {
+        if (source) {
+            wl_event_source_remove(source);
+        }
+    }
+    m_socketNotifiers.clear();
+    if (m_timerSource) {
+        wl_event_source_remove(m_timerSource);
+        m_timerSource = nullptr;
+    }
+    if (m_wakeUpSource) {
+        wl_event_source_remove(m_wakeUpSource);
+        m_wakeUpSource = nullptr;
+    }
+}
+
+int HyprlandEventDispatcher::handleSocketNotifier(int fd, uint32_t mask, void *data)
+{
+    activateSocketNotifier(static_cast<QSocketNotifier *>(data));
+    return 0;
+}
+
+int HyprlandEventDispatcher::handleTimer(void *data)
+{
+    static_cast<HyprlandEventDispatcher *>(data)->processTimers();
+    return 0;
+}
+
+int HyprlandEventDispatcher::handleWakeUp(int fd, uint32_t mask, void *data)
+{
+    uint64_t value;
+    read(fd, &value, sizeof(value));
+    static_cast<HyprlandEventDispatcher *>(data)->sendPostedEvents();
+    return 0;
+}
\ No newline at end of file
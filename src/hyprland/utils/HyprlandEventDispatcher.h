@@ -0,0 +1,103 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QAbstractEventDispatcher>
+#include <chrono>
+#include <map>
+#include <vector>
+
+struct wl_event_loop;
+struct wl_event_source;
+
+/**
+ * Runs Qt's main thread event processing inside the compositor's Wayland event loop. Socket notifiers are registered as
+ * event loop fds, all Qt timers share a single event loop timer armed to the nearest deadline, and posted events are
+ * delivered when an eventfd written by wakeUp becomes readable. Nothing runs while Qt is idle.
+ *
+ * Must be installed using QCoreApplication::setEventDispatcher before QCoreApplication is created.
+ */
+class HyprlandEventDispatcher : public QAbstractEventDispatcher
+{
+public:
+    HyprlandEventDispatcher(wl_event_loop *loop);
+    ~HyprlandEventDispatcher() override;
+
+    /**
+     * Only used for nested event loops, events are normally processed by the compositor's event loop.
+     */
+    bool processEvents(QEventLoop::ProcessEventsFlags flags) override;
+
+    void registerSocketNotifier(QSocketNotifier *notifier) override;
+    void unregisterSocketNotifier(QSocketNotifier *notifier) override;
+
+    void registerTimer(int timerId, qint64 interval, Qt::TimerType timerType, QObject *object) override;
+    bool unregisterTimer(int timerId) override;
+    bool unregisterTimers(QObject *object) override;
+    QList<TimerInfo> registeredTimers(QObject *object) const override;
+    int remainingTime(int timerId) override;
+
+    void wakeUp() override;
+    void interrupt() override;
+
+    void closingDown() override;
+
+private:
+    struct Timer
+    {
+        int id;
+        qint64 interval;
+        Qt::TimerType type;
+        QObject *object;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void sendPostedEvents();
+    /**
+     * @return Whether any timers have fired.
+     */
+    bool processTimers();
+    /**
+     * Arms the event loop timer for the nearest deadline, or disarms it if there are no timers.
+     */
+    void updateTimerSource();
+    /**
+     * @return Milliseconds until the nearest timer deadline, or -1 if there are no timers.
+     */
+    int nextTimerTimeout() const;
+    /**
+     * Removes all event loop sources. Called when the application is closing down, as the dispatcher may outlive it.
+     */
+    void removeSources();
+
+    static int handleSocketNotifier(int fd, uint32_t mask, void *data);
+    static int handleTimer(void *data);
+    static int handleWakeUp(int fd, uint32_t mask, void *data);
+
+    wl_event_loop *m_loop;
+    wl_event_source *m_timerSource{};
+    wl_event_source *m_wakeUpSource{};
+    int m_wakeUpFd = -1;
+
+    std::map<QSocketNotifier *, wl_event_source *> m_socketNotifiers;
+    std::vector<Timer> m_timers;
+
+    bool m_interrupted{};
+};
\ No newline at end of file
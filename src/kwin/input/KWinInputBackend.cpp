@@ -49,7 +49,9 @@ KWinInputBackend::KWinInputBackend()
 
 KWinInputBackend::~KWinInputBackend()
 {
-    reset();
+    for (auto &[_, device] : m_devices) {
+        removeDevice(device.libinputactionsDevice.get());
+    }
     if (auto *input = KWin::input()) {
         input->uninstallInputEventFilter(this);
     }
@@ -62,74 +64,65 @@ void KWinInputBackend::initialize()
     }
 }
 
-void KWinInputBackend::reset()
-{
-    for (auto &device : m_devices) {
-        deviceRemoved(device.libinputactionsDevice.get());
-    }
-    m_devices.clear();
-    LibinputCompositorInputBackend::reset();
-}
-
 bool KWinInputBackend::holdGestureBegin(int fingerCount, std::chrono::microseconds time)
 {
-    return touchpadHoldBegin(currentTouchpad(), fingerCount);
+    return touchpadHoldBegin(currentTouchpad(), fingerCount, time);
 }
 
 bool KWinInputBackend::holdGestureEnd(std::chrono::microseconds time)
 {
-    return touchpadHoldEnd(currentTouchpad(), false);
+    return touchpadHoldEnd(currentTouchpad(), false, time);
 }
 
 bool KWinInputBackend::holdGestureCancelled(std::chrono::microseconds time)
 {
-    return touchpadHoldEnd(currentTouchpad(), true);
+    return touchpadHoldEnd(currentTouchpad(), true, time);
 }
 
 bool KWinInputBackend::swipeGestureBegin(int fingerCount, std::chrono::microseconds time)
 {
-    return touchpadSwipeBegin(currentTouchpad(), fingerCount);
+    return touchpadSwipeBegin(currentTouchpad(), fingerCount, time);
 }
 
 bool KWinInputBackend::swipeGestureUpdate(const QPointF &delta, std::chrono::microseconds time)
 {
-    return touchpadSwipeUpdate(currentTouchpad(), delta);
+    return touchpadSwipeUpdate(currentTouchpad(), delta, time);
 }
 
 bool KWinInputBackend::swipeGestureEnd(std::chrono::microseconds time)
 {
-    return touchpadSwipeEnd(currentTouchpad(), false);
+    return touchpadSwipeEnd(currentTouchpad(), false, time);
 }
 
 bool KWinInputBackend::swipeGestureCancelled(std::chrono::microseconds time)
 {
-    return touchpadSwipeEnd(currentTouchpad(), true);
+    return touchpadSwipeEnd(currentTouchpad(), true, time);
 }
 
 bool KWinInputBackend::pinchGestureBegin(int fingerCount, std::chrono::microseconds time)
 {
-    return touchpadPinchBegin(currentTouchpad(), fingerCount);
+    return touchpadPinchBegin(currentTouchpad(), fingerCount, time);
 }
 
 bool KWinInputBackend::pinchGestureUpdate(qreal scale, qreal angleDelta, const QPointF &delta, std::chrono::microseconds time)
 {
-    return touchpadPinchUpdate(currentTouchpad(), scale, angleDelta);
+    return touchpadPinchUpdate(currentTouchpad(), scale, angleDelta, time);
 }
 
 bool KWinInputBackend::pinchGestureEnd(std::chrono::microseconds time)
 {
-    return touchpadPinchEnd(currentTouchpad(), false);
+    return touchpadPinchEnd(currentTouchpad(), false, time);
 }
 
 bool KWinInputBackend::pinchGestureCancelled(std::chrono::microseconds time)
 {
-    return touchpadPinchEnd(currentTouchpad(), true);
+    return touchpadPinchEnd(currentTouchpad(), true, time);
 }
 
 #ifdef KWIN_6_3_OR_GREATER
 bool KWinInputBackend::pointerMotion(KWin::PointerMotionEvent *event)
 {
-    return LibinputCompositorInputBackend::pointerMotion(findInputActionsDevice(event->device), event->delta);
+    return LibinputCompositorInputBackend::pointerMotion(findInputActionsDevice(event->device), event->delta, event->timestamp);
 }
 
 bool KWinInputBackend::pointerButton(KWin::PointerButtonEvent *event)
@@ -137,12 +130,16 @@ bool KWinInputBackend::pointerButton(KWin::PointerButtonEvent *event)
     return LibinputCompositorInputBackend::pointerButton(findInputActionsDevice(event->device),
                                                          event->button,
                                                          event->nativeButton,
-                                                         event->state == PointerButtonStatePressed);
+                                                         event->state == PointerButtonStatePressed,
+                                                         event->timestamp);
 }
 
 bool KWinInputBackend::keyboardKey(KWin::KeyboardKeyEvent *event)
 {
-    return LibinputCompositorInputBackend::keyboardKey(findInputActionsDevice(event->device), event->nativeScanCode, event->state == KeyboardKeyStatePressed);
+    return LibinputCompositorInputBackend::keyboardKey(findInputActionsDevice(event->device),
+                                                       event->nativeScanCode,
+                                                       event->state == KeyboardKeyStatePressed,
+                                                       event->timestamp);
 }
 #endif
 
@@ -153,6 +150,7 @@ bool KWinInputBackend::pointerAxis(KWin::PointerAxisEvent *event)
     const auto eventDelta = event->delta;
     const auto orientation = event->orientation;
     const auto inverted = event->inverted;
+    const auto timestamp = event->timestamp;
 #else
 bool KWinInputBackend::wheelEvent(KWin::WheelEvent *event)
 {
@@ -160,17 +158,22 @@ bool KWinInputBackend::wheelEvent(KWin::WheelEvent *event)
     const auto eventDelta = event->delta();
     const auto orientation = event->orientation();
     const auto inverted = event->inverted();
+    const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::milliseconds(event->timestamp()));
 #endif
 
     auto delta = orientation == Qt::Orientation::Horizontal ? QPointF(eventDelta, 0) : QPointF(0, eventDelta);
     if (inverted) {
         delta *= -1;
     }
-    return LibinputCompositorInputBackend::pointerAxis(findInputActionsDevice(device), delta);
+    return LibinputCompositorInputBackend::pointerAxis(findInputActionsDevice(device), delta, timestamp);
 }
 
 void KWinInputBackend::kwinDeviceAdded(KWin::InputDevice *kwinDevice)
 {
+    if (findInputActionsDevice(kwinDevice)) {
+        return;
+    }
+
     InputDeviceType type;
     if (kwinDevice->isKeyboard()) {
         type = InputDeviceType::Keyboard;
@@ -186,27 +189,22 @@ void KWinInputBackend::kwinDeviceAdded(KWin::InputDevice *kwinDevice)
         .kwinDevice = kwinDevice,
         .libinputactionsDevice = std::make_unique<libinputactions::InputDevice>(type, kwinDevice->name(), kwinDevice->property("sysName").toString()),
     };
-    deviceAdded(device.libinputactionsDevice.get());
-    m_devices.push_back(std::move(device));
+    addDevice(device.libinputactionsDevice.get());
+    m_devices[kwinDevice] = std::move(device);
 }
 
 void KWinInputBackend::kwinDeviceRemoved(const KWin::InputDevice *kwinDevice)
 {
-    for (auto it = m_devices.begin(); it != m_devices.end(); it++) {
-        if (it->kwinDevice == kwinDevice) {
-            deviceRemoved(it->libinputactionsDevice.get());
-            m_devices.erase(it);
-            return;
-        }
+    if (const auto it = m_devices.find(kwinDevice); it != m_devices.end()) {
+        removeDevice(it->second.libinputactionsDevice.get());
+        m_devices.erase(it);
     }
 }
 
 libinputactions::InputDevice *KWinInputBackend::findInputActionsDevice(const KWin::InputDevice *kwinDevice)
 {
-    for (auto &device : m_devices) {
-        if (device.kwinDevice == kwinDevice) {
-            return device.libinputactionsDevice.get();
-        }
+    if (const auto it = m_devices.find(kwinDevice); it != m_devices.end()) {
+        return it->second.libinputactionsDevice.get();
     }
     return {};
 }
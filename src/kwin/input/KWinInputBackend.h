@@ -20,6 +20,7 @@
 
 #include "input.h"
 #include <libinputactions/input/backends/LibinputCompositorInputBackend.h>
+#include <unordered_map>
 
 struct KWinInputDevice
 {
@@ -47,7 +48,6 @@ public:
     ~KWinInputBackend() override;
 
     void initialize() override;
-    void reset() final;
 
     bool holdGestureBegin(int fingerCount, std::chrono::microseconds time) override;
     bool holdGestureEnd(std::chrono::microseconds time) override;
@@ -84,5 +84,5 @@ private:
 
     bool isMouse(const KWin::InputDevice *device) const;
 
-    std::vector<KWinInputDevice> m_devices;
+    std::unordered_map<const KWin::InputDevice *, KWinInputDevice> m_devices;
 };
\ No newline at end of file
@@ -52,11 +52,13 @@ void KWinInputEmitter::keyboardClearModifiers()
     }
 
     const auto modifiers = libinputactions::g_keyboard->modifiers(); // This is not the real state, but it's fine in this case.
+    beginBatch();
     for (const auto &[key, modifier] : libinputactions::MODIFIERS) {
         if (modifiers & modifier) {
             keyboardKey(key, false);
         }
     }
+    commit();
 
     if (!globalShortcutsDisabled) {
         KWin::workspace()->disableGlobalShortcutsForClient(false);
@@ -65,9 +67,9 @@ void KWinInputEmitter::keyboardClearModifiers()
 
 void KWinInputEmitter::keyboardKey(uint32_t key, bool state)
 {
-    libinputactions::g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     Q_EMIT m_device->keyChanged(key, state ? KeyboardKeyStatePressed : KeyboardKeyStateReleased, timestamp(), m_device.get());
-    libinputactions::g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void KWinInputEmitter::keyboardText(const QString &text)
@@ -94,23 +96,33 @@ void KWinInputEmitter::keyboardText(const QString &text)
 
 void KWinInputEmitter::mouseButton(uint32_t button, bool state)
 {
-    libinputactions::g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
+    // Each button event gets its own frame
+    pointerFrame();
     Q_EMIT m_device->pointerButtonChanged(button, state ? PointerButtonStatePressed : PointerButtonStateReleased, timestamp(), m_device.get());
-    Q_EMIT m_device->pointerFrame(m_device.get());
-    libinputactions::g_inputBackend->setIgnoreEvents(false);
+    m_pointerFramePending = true;
+    commit();
 }
 
 void KWinInputEmitter::mouseMoveRelative(const QPointF &pos)
 {
-    libinputactions::g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     Q_EMIT m_device->pointerMotion(pos, pos, timestamp(), m_device.get());
-    Q_EMIT m_device->pointerFrame(m_device.get());
-    libinputactions::g_inputBackend->setIgnoreEvents(false);
+    m_pointerFramePending = true;
+    commit();
+}
+
+void KWinInputEmitter::mouseMoveAbsolute(const QPointF &pos)
+{
+    beginBatch();
+    Q_EMIT m_device->pointerMotionAbsolute(pos, timestamp(), m_device.get());
+    m_pointerFramePending = true;
+    commit();
 }
 
 void KWinInputEmitter::touchpadPinchBegin(uint8_t fingers)
 {
-    libinputactions::g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     const auto time = timestamp();
     m_input->processSpies([&fingers, &time](auto &&spy) {
         spy->pinchGestureBegin(fingers, time);
@@ -118,12 +130,12 @@ void KWinInputEmitter::touchpadPinchBegin(uint8_t fingers)
     m_input->processFilters([&fingers, &time](auto &&filter) {
         return filter->pinchGestureBegin(fingers, time);
     });
-    libinputactions::g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 void KWinInputEmitter::touchpadSwipeBegin(uint8_t fingers)
 {
-    libinputactions::g_inputBackend->setIgnoreEvents(true);
+    beginBatch();
     const auto time = timestamp();
     m_input->processSpies([&fingers, &time](auto &&spy) {
         spy->swipeGestureBegin(fingers, time);
@@ -131,7 +143,7 @@ void KWinInputEmitter::touchpadSwipeBegin(uint8_t fingers)
     m_input->processFilters([&fingers, &time](auto &&filter) {
         return filter->swipeGestureBegin(fingers, time);
     });
-    libinputactions::g_inputBackend->setIgnoreEvents(false);
+    commit();
 }
 
 InputDevice *KWinInputEmitter::device() const
@@ -139,6 +151,27 @@ InputDevice *KWinInputEmitter::device() const
     return m_device.get();
 }
 
+void KWinInputEmitter::batchBegun()
+{
+    libinputactions::g_inputBackend->setIgnoreEvents(true);
+}
+
+void KWinInputEmitter::batchCommitted()
+{
+    pointerFrame();
+    libinputactions::g_inputBackend->setIgnoreEvents(false);
+}
+
+void KWinInputEmitter::pointerFrame()
+{
+    if (!m_pointerFramePending) {
+        return;
+    }
+
+    Q_EMIT m_device->pointerFrame(m_device.get());
+    m_pointerFramePending = false;
+}
+
 QString InputDevice::name() const
 {
     return "inputactions";
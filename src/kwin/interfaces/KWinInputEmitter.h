@@ -62,13 +62,27 @@ public:
 
     void mouseButton(uint32_t button, bool state) override;
     void mouseMoveRelative(const QPointF &pos) override;
+    /**
+     * Moves the pointer to the specified global position. The motion is part of the current batch, if there is one.
+     */
+    void mouseMoveAbsolute(const QPointF &pos);
 
     void touchpadPinchBegin(uint8_t fingers) override;
     void touchpadSwipeBegin(uint8_t fingers) override;
 
     InputDevice *device() const;
 
+protected:
+    void batchBegun() override;
+    void batchCommitted() override;
+
 private:
+    /**
+     * Emits a pointer frame if pointer events have been emitted since the last one.
+     */
+    void pointerFrame();
+
     KWin::InputRedirection *m_input;
     std::unique_ptr<InputDevice> m_device;
+    bool m_pointerFramePending{};
 };
\ No newline at end of file
@@ -22,9 +22,7 @@
 #include "cursor.h"
 #include "cursorsource.h"
 #include "pointer_input.h"
-#include "utils.h"
 #include "workspace.h"
-#include <libinputactions/input/backends/InputBackend.h>
 
 using namespace libinputactions;
 
@@ -77,9 +75,5 @@ std::optional<QPointF> KWinPointer::screenPointerPosition()
 
 void KWinPointer::setGlobalPointerPosition(const QPointF &position)
 {
-    auto *device = static_cast<KWinInputEmitter *>(g_inputEmitter.get())->device();
-    g_inputBackend->setIgnoreEvents(true);
-    Q_EMIT device->pointerMotionAbsolute(position, timestamp(), device);
-    Q_EMIT device->pointerFrame(device);
-    g_inputBackend->setIgnoreEvents(false);
+    static_cast<KWinInputEmitter *>(g_inputEmitter.get())->mouseMoveAbsolute(position);
 }
\ No newline at end of file
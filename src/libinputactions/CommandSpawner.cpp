@@ -0,0 +1,208 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CommandSpawner.h"
+#include <QRegularExpression>
+#include <cerrno>
+#include <cstring>
+#include <libinputactions/globals.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace libinputactions
+{
+
+/**
+ * Characters that have a special meaning in the shell. Commands containing them are passed to /bin/sh.
+ */
+static const QString SHELL_CHARACTERS = "|&;<>()$`\\\"'*?[]#~={}!\n";
+
+CommandSpawner::~CommandSpawner()
+{
+    for (const auto &command : m_running) {
+        close(command->notifier->socket());
+    }
+}
+
+void CommandSpawner::spawn(const Value<QString> &command, const void *source, bool coalesce)
+{
+    std::erase_if(m_unwatched, [](const auto &pid) {
+        const auto result = waitpid(pid, nullptr, WNOHANG);
+        // ECHILD: The child has already been reaped by someone else
+        return result == pid || (result == -1 && errno == ECHILD);
+    });
+
+    if (coalesce && source) {
+        const auto isFromSource = [source](const auto &other) {
+            return other == source;
+        };
+        if (std::ranges::any_of(m_pending, isFromSource, &PendingCommand::source) || std::ranges::any_of(m_queue, isFromSource, &Command::source)
+            || std::ranges::any_of(m_running, isFromSource, &RunningCommand::source)) {
+            qCDebug(INPUTACTIONS) << "Command coalesced";
+            return;
+        }
+    }
+
+    if (m_maxQueuedCommands && m_queue.size() >= m_maxQueuedCommands) {
+        auto dropped = m_queue.begin();
+        if (source) {
+            if (const auto it = std::ranges::find(m_queue, source, &Command::source); it != m_queue.end()) {
+                dropped = it;
+            }
+        }
+        qCDebug(INPUTACTIONS) << "Command queue full, dropping command";
+        m_queue.erase(dropped);
+    }
+
+    m_queue.push_back({
+        .command = command,
+        .source = source,
+    });
+    startQueued();
+}
+
+void CommandSpawner::setMaxPendingCommands(uint32_t value)
+{
+    m_maxPendingCommands = value;
+}
+
+void CommandSpawner::setMaxQueuedCommands(uint32_t value)
+{
+    m_maxQueuedCommands = value;
+}
+
+void CommandSpawner::reset()
+{
+    m_queue.clear();
+    for (const auto &command : m_pending) {
+        command->source = nullptr;
+    }
+    for (const auto &command : m_running) {
+        command->source = nullptr;
+    }
+}
+
+void CommandSpawner::start(Command command)
+{
+    const auto pending = std::make_shared<PendingCommand>(command.source);
+    m_pending.push_back(pending);
+    command.command.getAsync([this, weakPending = std::weak_ptr(pending)](const QString &command) {
+        const auto pending = weakPending.lock();
+        if (!pending) {
+            // The spawner has been destroyed
+            return;
+        }
+
+        std::erase(m_pending, pending);
+        if (const auto pid = run(command); pid != -1) {
+            watch(pid, pending->source);
+        }
+        startQueued();
+    });
+}
+
+pid_t CommandSpawner::run(const QString &command)
+{
+    std::vector<QByteArray> arguments;
+    const auto direct = std::ranges::none_of(command, [](const auto &c) {
+        return SHELL_CHARACTERS.contains(c);
+    });
+    if (direct) {
+        static const QRegularExpression whitespace("\\s+");
+        for (const auto &argument : command.split(whitespace, Qt::SkipEmptyParts)) {
+            arguments.push_back(argument.toLocal8Bit());
+        }
+    }
+    if (arguments.empty()) {
+        arguments = {"/bin/sh", "-c", command.toLocal8Bit()};
+    }
+
+    std::vector<char *> argv;
+    for (auto &argument : arguments) {
+        argv.push_back(argument.data());
+    }
+    argv.push_back(nullptr);
+
+    // Don't pass the compositor's signal configuration to the child
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    sigset_t signals;
+    sigemptyset(&signals);
+    posix_spawnattr_setsigmask(&attributes, &signals);
+    sigfillset(&signals);
+    posix_spawnattr_setsigdefault(&attributes, &signals);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+    pid_t pid{};
+    auto error = posix_spawnp(&pid, argv[0], nullptr, &attributes, argv.data(), environ);
+    if (error && direct) {
+        // Possibly a shell builtin
+        arguments = {"/bin/sh", "-c", command.toLocal8Bit()};
+        argv = {arguments[0].data(), arguments[1].data(), arguments[2].data(), nullptr};
+        error = posix_spawn(&pid, argv[0], nullptr, &attributes, argv.data(), environ);
+    }
+    posix_spawnattr_destroy(&attributes);
+
+    if (error) {
+        qCWarning(INPUTACTIONS).noquote() << QString("Failed to run command (command: %1, error: %2)").arg(command, strerror(error));
+        return -1;
+    }
+    return pid;
+}
+
+void CommandSpawner::watch(pid_t pid, const void *source)
+{
+#ifdef SYS_pidfd_open
+    const auto fd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    const auto fd = -1;
+#endif
+    if (fd == -1) {
+        m_unwatched.push_back(pid);
+        return;
+    }
+
+    auto command = std::make_unique<RunningCommand>(pid, source, std::make_unique<QSocketNotifier>(fd, QSocketNotifier::Read));
+    QObject::connect(command->notifier.get(), &QSocketNotifier::activated, [this, pid, fd]() {
+        waitpid(pid, nullptr, WNOHANG);
+
+        const auto it = std::ranges::find(m_running, pid, &RunningCommand::pid);
+        auto notifier = std::move((*it)->notifier);
+        m_running.erase(it);
+
+        // Called from a signal of the notifier
+        notifier->setEnabled(false);
+        notifier.release()->deleteLater();
+        close(fd);
+    });
+    m_running.push_back(std::move(command));
+}
+
+void CommandSpawner::startQueued()
+{
+    while (!m_queue.empty() && m_pending.size() < m_maxPendingCommands) {
+        auto command = std::move(m_queue.front());
+        m_queue.pop_front();
+        start(std::move(command));
+    }
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QSocketNotifier>
+#include <QString>
+#include <deque>
+#include <libinputactions/Value.h>
+#include <memory>
+#include <sys/types.h>
+#include <vector>
+
+namespace libinputactions
+{
+
+/**
+ * Runs commands in new processes using posix_spawn, which does not copy the compositor's address space like fork does.
+ * Commands without shell syntax are executed directly, all others are executed by /bin/sh. Finished processes are
+ * reaped when their pidfd becomes readable.
+ *
+ * Commands are pending until their value has been computed, which does not block the caller. The amount of pending
+ * commands is limited, commands spawned after the limit has been reached are queued. When the queue is full, the oldest
+ * queued command of the same source is dropped, or the oldest one if the source has none. Running processes do not
+ * count towards the limit.
+ */
+class CommandSpawner
+{
+public:
+    ~CommandSpawner();
+
+    /**
+     * @param source Used for coalescing, may be nullptr.
+     * @param coalesce Whether to drop the command if a command from the same source is already pending, queued or
+     * running.
+     */
+    void spawn(const Value<QString> &command, const void *source = nullptr, bool coalesce = false);
+
+    /**
+     * @param value Default: 16
+     */
+    void setMaxPendingCommands(uint32_t value);
+    /**
+     * @param value 0 - unlimited. Default: 64
+     */
+    void setMaxQueuedCommands(uint32_t value);
+
+    /**
+     * Drops all queued commands and forgets the sources of pending and running ones. Must be called when sources are
+     * destroyed, as their addresses may be reused.
+     */
+    void reset();
+
+private:
+    struct Command
+    {
+        Value<QString> command;
+        const void *source;
+    };
+    struct PendingCommand
+    {
+        const void *source;
+    };
+    struct RunningCommand
+    {
+        pid_t pid;
+        const void *source;
+        std::unique_ptr<QSocketNotifier> notifier;
+    };
+
+    /**
+     * Computes the value of the command and runs it once it is available.
+     */
+    void start(Command command);
+    /**
+     * @return Process ID or -1 if the command could not be started.
+     */
+    static pid_t run(const QString &command);
+    /**
+     * Starts watching the process and reaps it once it finishes.
+     */
+    void watch(pid_t pid, const void *source);
+    /**
+     * Starts queued commands while below the limit.
+     */
+    void startQueued();
+
+    std::deque<Command> m_queue;
+    std::vector<std::shared_ptr<PendingCommand>> m_pending;
+    std::vector<std::unique_ptr<RunningCommand>> m_running;
+    /**
+     * Processes that could not be watched, reaped when a command is spawned.
+     */
+    std::vector<pid_t> m_unwatched;
+    uint32_t m_maxPendingCommands = 16;
+    uint32_t m_maxQueuedCommands = 64;
+};
+
+inline std::unique_ptr<CommandSpawner> g_commandSpawner;
+
+}
\ No newline at end of file
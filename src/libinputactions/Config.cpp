@@ -21,6 +21,7 @@
 #include <QFile>
 #include <QStandardPaths>
 #include <fcntl.h>
+#include <libinputactions/CommandSpawner.h>
 #include <libinputactions/input/backends/LibevdevComplementaryInputBackend.h>
 #include <libinputactions/yaml_convert.h>
 #include <sys/inotify.h>
@@ -91,6 +92,11 @@ Config::~Config()
     }
 }
 
+ConditionInterner &Config::conditionInterner()
+{
+    return m_conditionInterner;
+}
+
 std::optional<QString> Config::load(bool firstLoad)
 {
     qCDebug(INPUTACTIONS, "Reloading config");
@@ -101,7 +107,10 @@ std::optional<QString> Config::load(bool firstLoad)
             const auto config = YAML::LoadFile(m_path.toStdString());
             m_autoReload = config["autoreload"].as<bool>(true);
 
+            g_variableManager->beginUsageAnalysis();
+            m_conditionInterner.clear();
             auto eventHandlers = config.as<std::vector<std::unique_ptr<InputEventHandler>>>();
+            m_conditionInterner.clear();
             std::map<QString, InputDeviceProperties> customDeviceProperties;
             if (const auto &touchpadNode = config["touchpad"]) {
                 if (const auto &devicesNode = touchpadNode["devices"]) {
@@ -112,15 +121,15 @@ std::optional<QString> Config::load(bool firstLoad)
             }
 
             if (auto *libevdev = dynamic_cast<LibevdevComplementaryInputBackend *>(g_inputBackend.get())) {
-                if (const auto &pollingIntervalNode = config["__libevdev_polling_interval"]) {
-                    libevdev->setPollingInterval(pollingIntervalNode.as<uint32_t>());
-                }
-                if (const auto &enabledNode = config["__libevdev_enabled"]) {
-                    libevdev->setEnabled(enabledNode.as<bool>());
-                }
+                libevdev->setEnabled(config["__libevdev_enabled"].as<bool>(true));
             }
 
+            g_variableManager->endUsageAnalysis(true);
             g_inputBackend->reset();
+            if (g_commandSpawner) {
+                // Actions are used as coalescing sources
+                g_commandSpawner->reset();
+            }
             for (auto &eventHandler : eventHandlers) {
                 g_inputBackend->addEventHandler(std::move(eventHandler));
             }
@@ -133,6 +142,7 @@ std::optional<QString> Config::load(bool firstLoad)
                                      .arg(QString::fromStdString(e.msg), QString::number(e.mark.line), QString::number(e.mark.column));
             qCritical(INPUTACTIONS) << message;
             error = message;
+            g_variableManager->endUsageAnalysis(false);
         }
     } else {
         qCWarning(INPUTACTIONS) << "Configuration was not loaded automatically due to a crash.";
@@ -20,6 +20,7 @@
 
 #include <QObject>
 #include <QTimer>
+#include <libinputactions/conditions/ConditionInterner.h>
 
 namespace libinputactions
 {
@@ -37,6 +38,11 @@ public:
      */
     std::optional<QString> load(bool firstLoad = false);
 
+    /**
+     * Deduplicates conditions of the configuration that is currently being loaded.
+     */
+    ConditionInterner &conditionInterner();
+
 private:
     void initWatchers();
     void readEvents();
@@ -47,6 +53,7 @@ private:
     QTimer m_readEventsTimer;
 
     bool m_autoReload = true;
+    ConditionInterner m_conditionInterner;
 };
 
 inline std::unique_ptr<Config> g_config;
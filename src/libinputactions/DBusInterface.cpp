@@ -22,6 +22,8 @@
 #include <libinputactions/input/backends/InputBackend.h>
 #include <libinputactions/interfaces/OnScreenMessageManager.h>
 #include <libinputactions/triggers/StrokeTrigger.h>
+#include <libinputactions/variables/LocalVariable.h>
+#include <libinputactions/variables/PointComponentVariable.h>
 #include <libinputactions/variables/Variable.h>
 #include <libinputactions/variables/VariableManager.h>
 
@@ -30,16 +32,26 @@ namespace libinputactions
 
 static QString s_service = "org.inputactions";
 static QString s_path = "/";
+static const uint s_minimumVariableWatchInterval = 10;
 
 DBusInterface::DBusInterface()
     : m_bus(QDBusConnection::sessionBus())
+    , m_clientWatcher(QString(), m_bus, QDBusServiceWatcher::WatchForUnregistration)
 {
     m_bus.registerService(s_service);
     m_bus.registerObject(s_path, this, QDBusConnection::ExportAllSlots);
+
+    connect(&m_clientWatcher, &QDBusServiceWatcher::serviceUnregistered, this, [this](const auto &client) {
+        removeVariableWatch(client);
+    });
 }
 
 DBusInterface::~DBusInterface()
 {
+    if (m_variableObserver && g_variableManager) {
+        g_variableManager->removeObserver(m_variableObserver.value());
+    }
+
     m_bus.unregisterService(s_service);
     m_bus.unregisterObject(s_path);
 }
@@ -81,6 +93,8 @@ QString DBusInterface::reloadConfig()
 
 QString DBusInterface::variables(QString filter)
 {
+    g_variableManager->refreshUnused();
+
     QStringList result;
     const QRegularExpression filterRegex(filter);
     for (const auto &[name, variable] : g_variableManager->variables()) {
@@ -92,4 +106,106 @@ QString DBusInterface::variables(QString filter)
     return result.join('\n');
 }
 
+void DBusInterface::watchVariables(const QString &filter, uint interval, const QDBusMessage &message)
+{
+    const auto client = message.service();
+    removeVariableWatch(client);
+    g_variableManager->refreshUnused();
+
+    auto watch = std::make_unique<VariableWatch>();
+    const QRegularExpression filterRegex(filter);
+    for (const auto &[name, variable] : g_variableManager->variables()) {
+        if (!filterRegex.match(name).hasMatch()) {
+            continue;
+        }
+        watch->variables[name] = variable;
+        watch->changedVariables.insert(name);
+        // Unused variables may not be updated
+        g_variableManager->watch(name);
+
+        // Only local variables notify observers about changes
+        const auto *component = dynamic_cast<const PointComponentVariable *>(variable);
+        const auto *source = component ? component->parent() : variable;
+        if (!dynamic_cast<const LocalVariable *>(source)) {
+            watch->polledVariables.push_back(variable);
+        } else if (component) {
+            watch->components.emplace(source, variable);
+        }
+    }
+
+    watch->timer.setInterval(std::max(interval, s_minimumVariableWatchInterval));
+    watch->timer.setSingleShot(watch->polledVariables.empty());
+    connect(&watch->timer, &QTimer::timeout, this, [this, client]() {
+        sendChangedVariables(client);
+    });
+    watch->timer.start();
+    m_variableWatches[client] = std::move(watch);
+    m_clientWatcher.addWatchedService(client);
+
+    if (!m_variableObserver) {
+        m_variableObserver = g_variableManager->addObserver([this](const auto &name, const auto *variable) {
+            for (auto &[_, watch] : m_variableWatches) {
+                const auto [begin, end] = watch->components.equal_range(variable);
+                for (auto it = begin; it != end; it++) {
+                    // Notifies this observer if the component has changed
+                    it->second->version();
+                }
+
+                if (!watch->variables.contains(name)) {
+                    continue;
+                }
+                watch->changedVariables.insert(name);
+                if (!watch->timer.isActive()) {
+                    watch->timer.start();
+                }
+            }
+        });
+    }
+}
+
+void DBusInterface::unwatchVariables(const QDBusMessage &message)
+{
+    removeVariableWatch(message.service());
+}
+
+void DBusInterface::removeVariableWatch(const QString &client)
+{
+    const auto it = m_variableWatches.find(client);
+    if (it == m_variableWatches.end()) {
+        return;
+    }
+
+    for (const auto &[name, _] : it->second->variables) {
+        g_variableManager->unwatch(name);
+    }
+    m_variableWatches.erase(it);
+
+    m_clientWatcher.removeWatchedService(client);
+    if (m_variableWatches.empty() && m_variableObserver) {
+        g_variableManager->removeObserver(m_variableObserver.value());
+        m_variableObserver = {};
+    }
+}
+
+void DBusInterface::sendChangedVariables(const QString &client)
+{
+    auto &watch = *m_variableWatches.at(client);
+    for (const auto *variable : watch.polledVariables) {
+        variable->version();
+    }
+    if (watch.changedVariables.empty()) {
+        return;
+    }
+
+    QVariantMap values;
+    for (const auto &name : watch.changedVariables) {
+        values[name] = watch.variables.at(name)->operations()->toString();
+    }
+    watch.changedVariables.clear();
+
+    auto signal = QDBusMessage::createTargetedSignal(client, s_path, s_service, "VariablesChanged");
+    signal << values;
+    m_bus.send(signal);
+}
+
 }
\ No newline at end of file
@@ -18,11 +18,20 @@
 
 #include <QDBusConnection>
 #include <QDBusMessage>
+#include <QDBusServiceWatcher>
 #include <QObject>
+#include <QTimer>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
 
 namespace libinputactions
 {
 
+class Variable;
+
 class DBusInterface : public QObject
 {
     Q_OBJECT
@@ -43,10 +52,46 @@ public slots:
     Q_NOREPLY void recordStroke(const QDBusMessage &message);
     QString reloadConfig();
     QString variables(QString filter = "");
+    /**
+     * Sends the VariablesChanged(a{sv}) signal to the caller with the values of variables matching the filter that have
+     * changed, at most once per interval. The first signal contains all matching variables. Calling this method again
+     * replaces the previous filter and interval.
+     * @param interval In milliseconds.
+     */
+    void watchVariables(const QString &filter, uint interval, const QDBusMessage &message);
+    void unwatchVariables(const QDBusMessage &message);
 
 private:
+    struct VariableWatch
+    {
+        std::map<QString, const Variable *> variables;
+        std::set<QString> changedVariables;
+        /**
+         * Variables whose changes are only detected when they are read, checked on every tick of the timer.
+         */
+        std::vector<const Variable *> polledVariables;
+        /**
+         * Local parent variable -> watched component variable. Components are checked when their parent changes.
+         */
+        std::multimap<const Variable *, const Variable *> components;
+        /**
+         * Sends the changes. Started when a variable changes, or runs continuously if there are polled variables.
+         */
+        QTimer timer;
+    };
+
+    void removeVariableWatch(const QString &client);
+    void sendChangedVariables(const QString &client);
+
     QDBusConnection m_bus;
     QDBusMessage m_reply;
+
+    /**
+     * Client service name -> watch.
+     */
+    std::map<QString, std::unique_ptr<VariableWatch>> m_variableWatches;
+    QDBusServiceWatcher m_clientWatcher;
+    std::optional<uint64_t> m_variableObserver;
 };
 
 }
\ No newline at end of file
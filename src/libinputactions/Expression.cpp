@@ -18,6 +18,7 @@
 
 #include "Expression.h"
 #include <QRegularExpression>
+#include <QVarLengthArray>
 #include <libinputactions/variables/VariableManager.h>
 
 namespace libinputactions
@@ -26,32 +27,57 @@ namespace libinputactions
 template<typename T>
 Expression<T>::Expression(const QString &expression)
 {
-    m_expression = expression;
-
     static const QRegularExpression variableReferenceRegex("\\$([a-zA-Z0-9_])+");
-    const auto variables = g_variableManager->variables();
-    auto it = variableReferenceRegex.globalMatch(m_expression);
+    qsizetype literalStart{};
+    auto it = variableReferenceRegex.globalMatch(expression);
     while (it.hasNext()) {
         const auto match = it.next();
-        const auto variableName = match.captured(0).mid(1);
-        if (!variables.contains(variableName)) {
+        auto *variable = g_variableManager->getVariable(match.captured(0).mid(1));
+        if (!variable) {
             continue;
         }
-        m_variables.insert(variableName);
+        g_variableManager->markUsed(match.captured(0).mid(1));
+
+        m_segments.push_back({
+            .literal = expression.mid(literalStart, match.capturedStart() - literalStart),
+            .variable = variable,
+        });
+        literalStart = match.capturedEnd();
+    }
+    if (m_segments.empty() || literalStart < expression.size()) {
+        m_segments.push_back({
+            .literal = expression.mid(literalStart),
+        });
+    }
+    for (const auto &segment : m_segments) {
+        m_literalLength += segment.literal.size();
     }
 }
 
 template<>
 QString Expression<QString>::evaluate() const
 {
-    if (m_variables.empty()) {
-        return m_expression;
+    if (m_segments.size() == 1 && !m_segments[0].variable) {
+        return m_segments[0].literal;
     }
 
-    QString result = m_expression;
-    for (const auto &variable : m_variables) {
-        const auto value = g_variableManager->getVariable(variable)->operations()->toString();
-        result = result.replace(QRegularExpression("\\$" + variable + "(?![a-zA-Z0-9_])"), value);
+    // Convert the values first, so that the result is allocated only once
+    QVarLengthArray<QString, 4> values;
+    qsizetype length = m_literalLength;
+    for (const auto &segment : m_segments) {
+        if (segment.variable) {
+            length += values.emplace_back(segment.variable->operations()->toString()).size();
+        }
+    }
+
+    QString result;
+    result.reserve(length);
+    auto value = values.cbegin();
+    for (const auto &segment : m_segments) {
+        result += segment.literal;
+        if (segment.variable) {
+            result += *value++;
+        }
     }
     return result;
 }
@@ -19,11 +19,13 @@
 #pragma once
 
 #include <QString>
-#include <set>
+#include <vector>
 
 namespace libinputactions
 {
 
+class Variable;
+
 /**
  * An expression that evaluates to T.
  */
@@ -36,11 +38,20 @@ public:
     T evaluate() const;
 
 private:
-    QString m_expression;
+    struct Segment
+    {
+        QString literal;
+        /**
+         * Variable whose value follows the literal, nullptr if none.
+         */
+        Variable *variable{};
+    };
+
     /**
-     * Variable names referenced in the expression.
+     * The expression split at variable references, parsed once on construction.
      */
-    std::set<QString> m_variables;
+    std::vector<Segment> m_segments;
+    qsizetype m_literalLength{};
 };
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "InputActions.h"
+#include "CommandSpawner.h"
 #include "Config.h"
 #include "input/Keyboard.h"
 #include "input/backends/InputBackend.h"
@@ -24,6 +25,7 @@ InputActions::InputActions(std::unique_ptr<InputBackend> inputBackend)
     g_sessionLock = std::make_shared<SessionLock>();
     g_windowProvider = std::make_shared<WindowProvider>();
 
+    g_commandSpawner = std::make_unique<CommandSpawner>();
     g_config = std::make_unique<Config>();
     g_inputBackend = std::move(inputBackend);
     g_keyboard = std::make_unique<Keyboard>();
@@ -40,6 +42,7 @@ InputActions::~InputActions()
     g_sessionLock.reset();
     g_windowProvider.reset();
 
+    g_commandSpawner.reset();
     g_config.reset();
     g_inputBackend.reset();
     g_keyboard.reset();
@@ -18,12 +18,109 @@
 
 #include "Value.h"
 #include <QProcess>
+#include <chrono>
 #include <libinputactions/globals.h>
 #include <libinputactions/variables/VariableManager.h>
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace libinputactions
 {
 
+/**
+ * Runs a command asynchronously on the event loop and stores its last output.
+ */
+class CommandOutputCache : public std::enable_shared_from_this<CommandOutputCache>
+{
+public:
+    CommandOutputCache(Value<QString> command, const CommandValueOptions &options)
+        : m_command(std::move(command))
+        , m_options(options)
+    {
+    }
+
+    /**
+     * Refreshes the output if it has expired. Only waits for the refresh to finish if a timeout is set, and no longer than
+     * the timeout.
+     * @return The last output, empty if the command has never finished.
+     */
+    QString get()
+    {
+        refresh();
+        if (m_process && m_options.timeout) {
+            m_process->waitForFinished(*m_options.timeout);
+        }
+        return m_output.value_or(QString());
+    }
+
+    /**
+     * Calls the callback with the output immediately if it has not expired, otherwise once the refresh finishes.
+     */
+    void getAsync(std::function<void(const QString &output)> callback)
+    {
+        if (!m_process && !expired()) {
+            callback(*m_output);
+            return;
+        }
+
+        m_callbacks.push_back(std::move(callback));
+        refresh();
+    }
+
+    /**
+     * Runs the command if the output has expired and the command is not already running.
+     */
+    void refresh()
+    {
+        if (m_process || !expired()) {
+            return;
+        }
+
+        m_process = std::make_unique<QProcess>();
+        m_process->setProgram("/bin/sh");
+        m_process->setArguments({"-c", m_command.get()});
+        // The connections keep the cache alive until the command finishes
+        QObject::connect(m_process.get(), &QProcess::finished, [self = shared_from_this()]() {
+            self->onFinished();
+        });
+        QObject::connect(m_process.get(), &QProcess::errorOccurred, [self = shared_from_this()](QProcess::ProcessError error) {
+            if (error == QProcess::FailedToStart) {
+                self->onFinished();
+            }
+        });
+        m_process->start();
+    }
+
+private:
+    bool expired() const
+    {
+        return !m_output || std::chrono::steady_clock::now() - m_outputTime >= std::chrono::milliseconds(m_options.ttl);
+    }
+
+    void onFinished()
+    {
+        m_output = m_process->readAllStandardOutput();
+        m_outputTime = std::chrono::steady_clock::now();
+        // Called from a signal of the process
+        m_process.release()->deleteLater();
+
+        const auto callbacks = std::move(m_callbacks);
+        m_callbacks.clear();
+        for (const auto &callback : callbacks) {
+            callback(*m_output);
+        }
+    }
+
+    Value<QString> m_command;
+    CommandValueOptions m_options;
+
+    std::unique_ptr<QProcess> m_process;
+    std::vector<std::function<void(const QString &output)>> m_callbacks;
+    std::optional<QString> m_output;
+    std::chrono::steady_clock::time_point m_outputTime;
+};
+
 template<typename T>
 T fromString(const QString &s);
 
@@ -46,21 +143,29 @@ Value<T>::Value(std::function<T()> getter)
 }
 
 template<typename T>
-Value<T> Value<T>::command(Value<QString> command)
+Value<T> Value<T>::command(Value<QString> command, const CommandValueOptions &options)
 {
-    return Value<T>([command = std::move(command)]() {
-        QProcess process;
-        process.setProgram("/bin/sh");
-        process.setArguments({"-c", command.get()});
-        process.start();
-        process.waitForFinished();
-        return fromString<T>(process.readAllStandardOutput());
+    const auto cache = std::make_shared<CommandOutputCache>(std::move(command), options);
+    Value<T> value([cache]() {
+        return fromString<T>(cache->get());
     });
+    if (options.prefetch) {
+        value.m_prefetch = [cache]() {
+            cache->refresh();
+        };
+    }
+    value.m_getAsync = [cache](std::function<void(const T &value)> callback) {
+        cache->getAsync([callback = std::move(callback)](const QString &output) {
+            callback(fromString<T>(output));
+        });
+    };
+    return value;
 }
 
 template<typename T>
 Value<T> Value<T>::variable(QString name)
 {
+    g_variableManager->markUsed(name);
     return Value<T>([name = std::move(name)]() {
         return g_variableManager->getVariable<T>(name)->get().value();
     });
@@ -89,6 +194,24 @@ T Value<T>::get() const
     // clang-format on
 }
 
+template<typename T>
+void Value<T>::getAsync(std::function<void(const T &value)> callback) const
+{
+    if (m_getAsync) {
+        m_getAsync(std::move(callback));
+        return;
+    }
+    callback(get());
+}
+
+template<typename T>
+void Value<T>::prefetch() const
+{
+    if (m_prefetch) {
+        m_prefetch();
+    }
+}
+
 template class Value<QString>;
 
 }
\ No newline at end of file
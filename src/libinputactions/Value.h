@@ -20,12 +20,33 @@
 
 #include "Expression.h"
 #include <QString>
+#include <cstdint>
 #include <functional>
+#include <optional>
 #include <variant>
 
 namespace libinputactions
 {
 
+struct CommandValueOptions
+{
+    /**
+     * How long the output of the command is valid for, in milliseconds. The command is run again when the value is
+     * accessed after it has expired. 0 means the output expires immediately.
+     */
+    uint32_t ttl{};
+    /**
+     * How long to wait for the command to finish when the value is accessed, in milliseconds. If the command does not
+     * finish in time, the last output is returned. If not set, the last output is returned immediately and the command
+     * runs in the background.
+     */
+    std::optional<uint32_t> timeout;
+    /**
+     * Whether to run the command when the trigger is activated.
+     */
+    bool prefetch{};
+};
+
 template<typename T>
 class Value
 {
@@ -34,13 +55,28 @@ public:
     Value(std::function<T()> getter);
     Value(Expression<T> expression);
 
-    static Value<T> command(Value<QString> command);
+    /**
+     * The command is run asynchronously. get() returns the last output (empty before the first run finishes) and only
+     * waits for the command if a timeout is set. getAsync() waits for an up-to-date output without blocking.
+     */
+    static Value<T> command(Value<QString> command, const CommandValueOptions &options = {});
     static Value<T> variable(QString name);
 
     T get() const;
+    /**
+     * Calls the callback with the value once it is available. Values that are not computed in the background call it
+     * immediately.
+     */
+    void getAsync(std::function<void(const T &value)> callback) const;
+    /**
+     * Starts computing the value in the background, if the value supports it.
+     */
+    void prefetch() const;
 
 private:
     std::variant<T, std::function<T()>> m_value;
+    std::function<void()> m_prefetch;
+    std::function<void(std::function<void(const T &value)>)> m_getAsync;
 };
 
 }
\ No newline at end of file
@@ -17,7 +17,7 @@
 */
 
 #include "CommandTriggerAction.h"
-#include <thread>
+#include <libinputactions/CommandSpawner.h>
 
 namespace libinputactions
 {
@@ -27,13 +27,21 @@ CommandTriggerAction::CommandTriggerAction(const Value<QString> &command)
 {
 }
 
-void CommandTriggerAction::execute()
+void CommandTriggerAction::execute(uint32_t executions)
 {
-    std::thread thread([this]() {
-        const auto command = m_command.get().toStdString();
-        std::ignore = std::system(command.c_str());
-    });
-    thread.detach();
+    for (uint32_t i = 0; i < executions; i++) {
+        g_commandSpawner->spawn(m_command, this, m_coalesce);
+    }
+}
+
+void CommandTriggerAction::prefetchValues()
+{
+    m_command.prefetch();
+}
+
+void CommandTriggerAction::setCoalesce(bool value)
+{
+    m_coalesce = value;
 }
 
 }
\ No newline at end of file
@@ -33,10 +33,17 @@ class CommandTriggerAction : public TriggerAction
 public:
     explicit CommandTriggerAction(const Value<QString> &command);
 
-    void execute() override;
+    void execute(uint32_t executions) override;
+    void prefetchValues() override;
+
+    /**
+     * @param value Whether to skip executions while a previous one is still running. Default: false
+     */
+    void setCoalesce(bool value);
 
 private:
     Value<QString> m_command;
+    bool m_coalesce{};
 };
 
 }
\ No newline at end of file
@@ -23,42 +23,81 @@
 namespace libinputactions
 {
 
-void InputTriggerAction::execute()
+void InputTriggerAction::execute(uint32_t executions)
+{
+    g_inputEmitter->beginBatch();
+    for (uint32_t i = 0; i < executions; i++) {
+        executeOperations();
+    }
+    g_inputEmitter->commit();
+}
+
+void InputTriggerAction::executeOperations()
+{
+    for (const auto &operation : m_operations) {
+        switch (operation.type) {
+            case OperationType::KeyboardKey:
+                g_inputEmitter->keyboardKey(operation.code, operation.state);
+                break;
+            case OperationType::KeyboardText:
+                if (const auto text = operation.text->get(); !text.isEmpty()) {
+                    g_inputEmitter->keyboardText(text);
+                }
+                break;
+            case OperationType::MouseButton:
+                g_inputEmitter->mouseButton(operation.code, operation.state);
+                break;
+            case OperationType::MouseMoveAbsolute:
+                g_pointerPositionSetter->setGlobalPointerPosition(operation.position);
+                break;
+            case OperationType::MouseMoveRelative:
+                g_inputEmitter->mouseMoveRelative(operation.position);
+                break;
+            case OperationType::MouseMoveRelativeByDelta:
+                g_inputEmitter->mouseMoveRelative(m_currentDeltaPointMultiplied);
+                break;
+        }
+    }
+}
+
+void InputTriggerAction::prefetchValues()
 {
+    for (const auto &action : m_sequence) {
+        action.keyboardText.prefetch();
+    }
+}
+
+void InputTriggerAction::setSequence(const std::vector<InputAction> &sequence)
+{
+    m_sequence = sequence;
+
+    m_operations.clear();
     for (const auto &action : m_sequence) {
         for (const auto &key : action.keyboardPress) {
-            g_inputEmitter->keyboardKey(key, true);
+            m_operations.push_back({.type = OperationType::KeyboardKey, .code = key, .state = true});
         }
         for (const auto &key : action.keyboardRelease) {
-            g_inputEmitter->keyboardKey(key, false);
-        }
-        const auto keyboardText = action.keyboardText.get();
-        if (!keyboardText.isEmpty()) {
-            g_inputEmitter->keyboardText(keyboardText);
+            m_operations.push_back({.type = OperationType::KeyboardKey, .code = key, .state = false});
         }
+        m_operations.push_back({.type = OperationType::KeyboardText, .text = &action.keyboardText});
 
         for (const auto &button : action.mousePress) {
-            g_inputEmitter->mouseButton(button, true);
+            m_operations.push_back({.type = OperationType::MouseButton, .code = button, .state = true});
         }
         for (const auto &button : action.mouseRelease) {
-            g_inputEmitter->mouseButton(button, false);
+            m_operations.push_back({.type = OperationType::MouseButton, .code = button, .state = false});
         }
 
         if (!action.mouseMoveAbsolute.isNull()) {
-            g_pointerPositionSetter->setGlobalPointerPosition(action.mouseMoveAbsolute);
+            m_operations.push_back({.type = OperationType::MouseMoveAbsolute, .position = action.mouseMoveAbsolute});
         }
         if (!action.mouseMoveRelative.isNull()) {
-            g_inputEmitter->mouseMoveRelative(action.mouseMoveRelative);
+            m_operations.push_back({.type = OperationType::MouseMoveRelative, .position = action.mouseMoveRelative});
         }
         if (action.mouseMoveRelativeByDelta) {
-            g_inputEmitter->mouseMoveRelative(m_currentDeltaPointMultiplied);
+            m_operations.push_back({.type = OperationType::MouseMoveRelativeByDelta});
         }
     }
 }
 
-void InputTriggerAction::setSequence(const std::vector<InputAction> &sequence)
-{
-    m_sequence = sequence;
-}
-
 }
\ No newline at end of file
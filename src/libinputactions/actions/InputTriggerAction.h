@@ -49,11 +49,46 @@ struct InputAction
 class InputTriggerAction : public TriggerAction
 {
 public:
-    void execute() override;
+    void execute(uint32_t executions) override;
+    void prefetchValues() override;
     void setSequence(const std::vector<InputAction> &sequence);
 
 private:
+    enum class OperationType
+    {
+        KeyboardKey,
+        KeyboardText,
+        MouseButton,
+        MouseMoveAbsolute,
+        MouseMoveRelative,
+        MouseMoveRelativeByDelta
+    };
+
+    struct Operation
+    {
+        OperationType type;
+        /**
+         * Key or button code.
+         */
+        uint32_t code{};
+        /**
+         * True - press, false - release
+         */
+        bool state{};
+        QPointF position;
+        /**
+         * Points to the value stored in m_sequence.
+         */
+        const Value<QString> *text{};
+    };
+
+    void executeOperations();
+
     std::vector<InputAction> m_sequence;
+    /**
+     * The sequence flattened into the order in which operations are performed.
+     */
+    std::vector<Operation> m_operations;
 };
 
 }
\ No newline at end of file
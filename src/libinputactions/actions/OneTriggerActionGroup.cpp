@@ -21,11 +21,11 @@
 namespace libinputactions
 {
 
-void OneTriggerActionGroup::execute()
+void OneTriggerActionGroup::execute(uint32_t executions)
 {
     for (auto &action : m_actions) {
         if (action->canExecute()) {
-            action->tryExecute();
+            action->tryExecute(executions);
             break;
         }
     }
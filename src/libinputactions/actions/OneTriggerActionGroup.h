@@ -32,7 +32,7 @@ public:
     OneTriggerActionGroup() = default;
 
 protected:
-    void execute() override;
+    void execute(uint32_t executions) override;
 };
 
 }
\ No newline at end of file
@@ -22,10 +22,12 @@
 namespace libinputactions
 {
 
-void PlasmaGlobalShortcutTriggerAction::execute()
+void PlasmaGlobalShortcutTriggerAction::execute(uint32_t executions)
 {
     QDBusInterface interface("org.kde.kglobalaccel", m_path, "org.kde.kglobalaccel.Component");
-    interface.call("invokeShortcut", m_shortcut);
+    for (uint32_t i = 0; i < executions; i++) {
+        interface.call("invokeShortcut", m_shortcut);
+    }
 }
 
 void PlasmaGlobalShortcutTriggerAction::setComponent(const QString &component)
@@ -30,7 +30,7 @@ namespace libinputactions
 class PlasmaGlobalShortcutTriggerAction : public TriggerAction
 {
 public:
-    void execute() override;
+    void execute(uint32_t executions) override;
     void setComponent(const QString &component);
     void setShortcut(const QString &shortcut);
 
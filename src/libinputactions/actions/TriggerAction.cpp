@@ -17,6 +17,7 @@
 */
 
 #include "TriggerAction.h"
+#include <algorithm>
 
 Q_LOGGING_CATEGORY(INPUTACTIONS_ACTION, "inputactions.action", QtWarningMsg)
 
@@ -59,15 +60,17 @@ void TriggerAction::triggerUpdated(qreal delta, const QPointF &deltaPointMultipl
         return;
     }
 
-    // Keep executing action until accumulated delta no longer exceeds the interval
-    while (m_interval.matches(m_accumulatedDelta) && std::abs(m_accumulatedDelta / interval) >= 1) {
-        tryExecute();
-        if (std::signbit(m_accumulatedDelta) != std::signbit(interval)) {
-            m_accumulatedDelta += interval;
-        } else {
-            m_accumulatedDelta -= interval;
-        }
+    if (!m_interval.matches(m_accumulatedDelta)) {
+        return;
+    }
+
+    // Execute the action once for every interval the accumulated delta exceeds, clamped as the conversion of out-of-range values is undefined
+    const auto executions = static_cast<uint32_t>(std::min<qreal>(std::abs(m_accumulatedDelta / interval), UINT32_MAX));
+    if (executions == 0) {
+        return;
     }
+    m_accumulatedDelta = std::fmod(m_accumulatedDelta, interval);
+    tryExecute(executions);
 }
 
 void TriggerAction::triggerEnded()
@@ -90,20 +93,20 @@ void TriggerAction::triggerCancelled()
     reset();
 }
 
-void TriggerAction::tryExecute()
+void TriggerAction::tryExecute(uint32_t executions)
 {
     if (!canExecute()) {
         return;
     }
 
-    qCDebug(INPUTACTIONS_ACTION).noquote() << QString("Action executed (name: %1)").arg(m_name);
-    execute();
+    qCDebug(INPUTACTIONS_ACTION).noquote() << QString("Action executed (name: %1, executions: %2)").arg(m_name, QString::number(executions));
+    execute(executions);
     m_executed = true;
 }
 
 bool TriggerAction::canExecute() const
 {
-    return (!m_condition || m_condition.value()->satisfied()) && (!m_threshold || m_threshold->contains(m_absoluteAccumulatedDelta));
+    return (!m_condition || m_condition->evaluate()) && (!m_threshold || m_threshold->contains(m_absoluteAccumulatedDelta));
 }
 
 void TriggerAction::reset()
@@ -114,7 +117,7 @@ void TriggerAction::reset()
 
 void TriggerAction::setCondition(const std::shared_ptr<const Condition> &condition)
 {
-    m_condition = condition;
+    m_condition = ConditionProgram(condition);
 }
 
 const bool &TriggerAction::executed() const
@@ -23,6 +23,7 @@
 #include <QString>
 #include <libinputactions/Range.h>
 #include <libinputactions/conditions/Condition.h>
+#include <libinputactions/conditions/ConditionProgram.h>
 #include <memory>
 
 Q_DECLARE_LOGGING_CATEGORY(INPUTACTIONS_ACTION)
@@ -115,11 +116,18 @@ public:
      */
     TEST_VIRTUAL void triggerCancelled();
 
+    /**
+     * Called by the trigger when it is activated. Starts computing values that support prefetching.
+     * @internal
+     */
+    virtual void prefetchValues() {};
+
     /**
      * Executes the action if it can be executed.
+     * @param executions How many times to execute the action. Conditions are only checked once.
      * @see canExecute
      */
-    TEST_VIRTUAL void tryExecute();
+    TEST_VIRTUAL void tryExecute(uint32_t executions = 1);
     /**
      * @return Whether the action had been executed during the trigger.
      */
@@ -164,8 +172,10 @@ protected:
 
     /**
      * Executes the action without checking conditions.
+     * @param executions How many times to execute the action. Implementations should perform all executions at once,
+     * as efficiently as possible.
      */
-    virtual void execute() {};
+    virtual void execute(uint32_t executions) {};
 
     // This is just a quick way to get directionless swipe gestures working
     QPointF m_currentDeltaPointMultiplied;
@@ -180,7 +190,7 @@ private:
     On m_on = On::End;
     ActionInterval m_interval;
     std::optional<Range<qreal>> m_threshold;
-    std::optional<std::shared_ptr<const Condition>> m_condition;
+    std::optional<ConditionProgram> m_condition;
     bool m_executed{};
 
     /**
@@ -26,6 +26,11 @@ CallbackCondition::CallbackCondition(const std::function<bool()> &func)
 {
 }
 
+uint32_t CallbackCondition::cost() const
+{
+    return 10;
+}
+
 bool CallbackCondition::satisfiedInternal() const
 {
     return m_func();
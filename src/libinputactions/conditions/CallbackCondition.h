@@ -29,6 +29,11 @@ class CallbackCondition : public Condition
 public:
     explicit CallbackCondition(const std::function<bool()> &func);
 
+    /**
+     * The cost of callbacks is unknown, so they're assumed to be as expensive as remote variables.
+     */
+    uint32_t cost() const override;
+
 protected:
     bool satisfiedInternal() const override;
 
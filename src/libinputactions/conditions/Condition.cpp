@@ -26,14 +26,41 @@ bool Condition::satisfied() const
     return satisfiedInternal() == !m_negate;
 }
 
+const bool &Condition::negate() const
+{
+    return m_negate;
+}
+
 void Condition::setNegate(bool value)
 {
     m_negate = value;
 }
 
+uint32_t Condition::cost() const
+{
+    return 0;
+}
+
 bool Condition::satisfiedInternal() const
 {
     return true;
 }
 
+ConditionEvaluationScope::ConditionEvaluationScope()
+{
+    if (s_depth++ == 0) {
+        s_generation++;
+    }
+}
+
+ConditionEvaluationScope::~ConditionEvaluationScope()
+{
+    s_depth--;
+}
+
+uint64_t ConditionEvaluationScope::generation()
+{
+    return s_depth ? s_generation : 0;
+}
+
 }
\ No newline at end of file
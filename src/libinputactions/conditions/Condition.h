@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace libinputactions
 {
 
@@ -27,12 +29,40 @@ public:
     virtual ~Condition() = default;
 
     bool satisfied() const;
+
+    const bool &negate() const;
     void setNegate(bool value);
 
+    /**
+     * @return Estimated cost of evaluating the condition. Condition groups evaluate cheaper conditions first.
+     */
+    virtual uint32_t cost() const;
+
 private:
     virtual bool satisfiedInternal() const;
 
     bool m_negate{};
 };
 
+/**
+ * While at least one scope exists, results of variable conditions are memoized, so that conditions shared by multiple
+ * triggers are only evaluated once, and remote variables are only read once. Variables must not change while a scope
+ * exists.
+ */
+class ConditionEvaluationScope
+{
+public:
+    ConditionEvaluationScope();
+    ~ConditionEvaluationScope();
+
+    /**
+     * @return The generation of the outermost existing scope, 0 if there is none.
+     */
+    static uint64_t generation();
+
+private:
+    inline static uint32_t s_depth{};
+    inline static uint64_t s_generation{};
+};
+
 }
\ No newline at end of file
@@ -51,4 +51,23 @@ void ConditionGroup::add(const std::shared_ptr<const Condition> &condition)
     m_conditions.push_back(condition);
 }
 
+const std::vector<std::shared_ptr<const Condition>> &ConditionGroup::conditions() const
+{
+    return m_conditions;
+}
+
+const ConditionGroupMode &ConditionGroup::mode() const
+{
+    return m_mode;
+}
+
+uint32_t ConditionGroup::cost() const
+{
+    uint32_t cost{};
+    for (const auto &condition : m_conditions) {
+        cost += condition->cost();
+    }
+    return cost;
+}
+
 }
\ No newline at end of file
@@ -43,6 +43,14 @@ public:
 
     void add(const std::shared_ptr<const Condition> &condition);
 
+    const std::vector<std::shared_ptr<const Condition>> &conditions() const;
+    const ConditionGroupMode &mode() const;
+
+    /**
+     * @return The sum of costs of all conditions.
+     */
+    uint32_t cost() const override;
+
 protected:
     bool satisfiedInternal() const override;
 
@@ -0,0 +1,115 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ConditionInterner.h"
+#include "ConditionGroup.h"
+#include "VariableCondition.h"
+#include "VariablePatternMatcher.h"
+#include <QHash>
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+std::shared_ptr<Condition> ConditionInterner::intern(const std::shared_ptr<Condition> &condition)
+{
+    const auto hash = ConditionInterner::hash(condition.get());
+    if (!hash) {
+        return condition;
+    }
+
+    auto &conditions = m_conditions[*hash];
+    for (const auto &interned : conditions) {
+        if (equal(interned.get(), condition.get())) {
+            return interned;
+        }
+    }
+    conditions.push_back(condition);
+
+    if (auto *variableCondition = dynamic_cast<VariableCondition *>(condition.get());
+        variableCondition && variableCondition->comparisonOperator() == ComparisonOperator::Regex && !variableCondition->values().empty()) {
+        const auto *variable = g_variableManager->getVariable(variableCondition->variableName());
+        if (variable->type() == typeid(QString) && variableCondition->values()[0].type() == typeid(QString)) {
+            auto &matcher = m_patternMatchers[variableCondition->variableName()];
+            if (!matcher) {
+                matcher = std::make_shared<VariablePatternMatcher>(variable);
+            }
+            variableCondition->setPatternMatcher(matcher, matcher->add(std::any_cast<QString>(variableCondition->values()[0])));
+        }
+    }
+    return condition;
+}
+
+void ConditionInterner::clear()
+{
+    m_conditions.clear();
+    m_patternMatchers.clear();
+}
+
+std::optional<size_t> ConditionInterner::hash(const Condition *condition)
+{
+    size_t hash = qHashMulti(0, condition->negate());
+    if (const auto *group = dynamic_cast<const ConditionGroup *>(condition)) {
+        hash = qHashMulti(hash, static_cast<int>(group->mode()));
+        for (const auto &child : group->conditions()) {
+            hash = qHashMulti(hash, child.get());
+        }
+        return hash;
+    } else if (const auto *variableCondition = dynamic_cast<const VariableCondition *>(condition)) {
+        if (!g_variableManager->getVariable(variableCondition->variableName())) {
+            return {};
+        }
+        return qHashMulti(hash, variableCondition->variableName(), static_cast<int>(variableCondition->comparisonOperator()), variableCondition->values().size());
+    }
+    return {};
+}
+
+bool ConditionInterner::equal(const Condition *left, const Condition *right)
+{
+    if (typeid(*left) != typeid(*right) || left->negate() != right->negate()) {
+        return false;
+    }
+
+    if (const auto *leftGroup = dynamic_cast<const ConditionGroup *>(left)) {
+        const auto *rightGroup = static_cast<const ConditionGroup *>(right);
+        return leftGroup->mode() == rightGroup->mode() && leftGroup->conditions() == rightGroup->conditions();
+    } else if (const auto *leftVariableCondition = dynamic_cast<const VariableCondition *>(left)) {
+        const auto *rightVariableCondition = static_cast<const VariableCondition *>(right);
+        if (leftVariableCondition->variableName() != rightVariableCondition->variableName()
+            || leftVariableCondition->comparisonOperator() != rightVariableCondition->comparisonOperator()
+            || leftVariableCondition->values().size() != rightVariableCondition->values().size()) {
+            return false;
+        }
+
+        const auto *operations = g_variableManager->getVariable(leftVariableCondition->variableName())->operations();
+        if (!operations) {
+            return false;
+        }
+        const auto &leftValues = leftVariableCondition->values();
+        const auto &rightValues = rightVariableCondition->values();
+        for (size_t i = 0; i < leftValues.size(); i++) {
+            if (!operations->equals(leftValues[i], rightValues[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+}
\ No newline at end of file
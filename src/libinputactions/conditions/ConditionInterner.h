@@ -0,0 +1,68 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Condition.h"
+#include <QString>
+#include <map>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace libinputactions
+{
+
+class VariablePatternMatcher;
+
+/**
+ * Deduplicates conditions, so that identical conditions used by multiple triggers are represented by the same object
+ * and only evaluated once per ConditionEvaluationScope. Only groups and variable conditions are deduplicated.
+ *
+ * Regex conditions of the same variable share a VariablePatternMatcher.
+ *
+ * Conditions must not be modified after being interned.
+ */
+class ConditionInterner
+{
+public:
+    /**
+     * @param condition Conditions of groups should be interned first, groups are compared by the addresses of their
+     * conditions.
+     * @return A previously interned condition identical to the specified one, otherwise the specified condition.
+     */
+    std::shared_ptr<Condition> intern(const std::shared_ptr<Condition> &condition);
+
+    /**
+     * Removes all interned conditions and pattern matchers.
+     */
+    void clear();
+
+private:
+    /**
+     * @return Hash of the condition or std::nullopt if it can't be deduplicated.
+     */
+    static std::optional<size_t> hash(const Condition *condition);
+    static bool equal(const Condition *left, const Condition *right);
+
+    std::unordered_map<size_t, std::vector<std::shared_ptr<Condition>>> m_conditions;
+    std::map<QString, std::shared_ptr<VariablePatternMatcher>> m_patternMatchers;
+};
+
+}
\ No newline at end of file
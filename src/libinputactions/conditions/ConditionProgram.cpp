@@ -0,0 +1,184 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ConditionProgram.h"
+#include "ConditionGroup.h"
+#include "VariableCondition.h"
+#include <algorithm>
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+ConditionProgram::ConditionProgram(const std::shared_ptr<const Condition> &condition)
+    : m_condition(condition)
+{
+    compile(m_condition.get());
+}
+
+bool ConditionProgram::evaluate() const
+{
+    if (!m_cacheable) {
+        return run();
+    }
+
+    // Remote variables are read to check their version, the scope makes the comparisons reuse that value
+    const ConditionEvaluationScope scope;
+
+    // The result only depends on the variables read by the previous run, the others were skipped. They are checked in the
+    // order they were read, the first change stops the check before more expensive variables are read.
+    const auto unchanged = std::ranges::all_of(m_readVersions, [](const auto &read) {
+        return read.variable->version() == read.version;
+    });
+    if (!m_result || !unchanged) {
+        m_readVersions.clear();
+        m_result = run();
+    }
+    return m_result.value();
+}
+
+bool ConditionProgram::run() const
+{
+    bool result = true;
+    const auto size = m_instructions.size();
+    for (size_t i = 0; i < size;) {
+        const auto &instruction = m_instructions[i];
+        switch (instruction.type) {
+            case ConditionInstructionType::Constant:
+                result = instruction.constant;
+                break;
+            case ConditionInstructionType::Compare:
+                if (m_cacheable) {
+                    m_readVersions.push_back({
+                        .variable = instruction.variable,
+                        .version = instruction.variable->version(),
+                    });
+                }
+                result = static_cast<const VariableCondition *>(instruction.condition)->compare(instruction.variable);
+                break;
+            case ConditionInstructionType::Evaluate:
+                result = instruction.condition->satisfied();
+                break;
+            case ConditionInstructionType::Not:
+                result = !result;
+                break;
+            case ConditionInstructionType::JumpIfFalse:
+                if (!result) {
+                    i = instruction.target;
+                    continue;
+                }
+                break;
+            case ConditionInstructionType::JumpIfTrue:
+                if (result) {
+                    i = instruction.target;
+                    continue;
+                }
+                break;
+        }
+        i++;
+    }
+    return result;
+}
+
+const std::vector<ConditionInstruction> &ConditionProgram::instructions() const
+{
+    return m_instructions;
+}
+
+const std::vector<Variable *> &ConditionProgram::dependencies() const
+{
+    return m_dependencies;
+}
+
+void ConditionProgram::compile(const Condition *condition)
+{
+    if (const auto *group = dynamic_cast<const ConditionGroup *>(condition)) {
+        const auto &mode = group->mode();
+
+        // The result of a group doesn't depend on the order of its conditions, cheaper ones are evaluated first so that
+        // expensive ones can be skipped
+        std::vector<const Condition *> conditions;
+        conditions.reserve(group->conditions().size());
+        for (const auto &condition : group->conditions()) {
+            conditions.push_back(condition.get());
+        }
+        std::ranges::stable_sort(conditions, {}, [](const auto *condition) {
+            return condition->cost();
+        });
+
+        if (conditions.empty()) {
+            m_instructions.push_back({
+                .type = ConditionInstructionType::Constant,
+                .constant = mode != ConditionGroupMode::Any,
+            });
+        } else {
+            // Every jump skips the remaining conditions of the group, the result is already known at that point
+            std::vector<size_t> jumps;
+            for (size_t i = 0; i < conditions.size(); i++) {
+                compile(conditions[i]);
+                if (i == conditions.size() - 1) {
+                    break;
+                }
+
+                jumps.push_back(m_instructions.size());
+                m_instructions.push_back({
+                    .type = mode == ConditionGroupMode::All ? ConditionInstructionType::JumpIfFalse : ConditionInstructionType::JumpIfTrue,
+                });
+            }
+            for (const auto &jump : jumps) {
+                m_instructions[jump].target = m_instructions.size();
+            }
+
+            if (mode == ConditionGroupMode::None) {
+                m_instructions.push_back({
+                    .type = ConditionInstructionType::Not,
+                });
+            }
+        }
+    } else if (const auto *variableCondition = dynamic_cast<const VariableCondition *>(condition);
+               variableCondition && g_variableManager->getVariable(variableCondition->variableName())) {
+        auto *variable = g_variableManager->getVariable(variableCondition->variableName());
+        if (!std::ranges::contains(m_dependencies, variable)) {
+            m_dependencies.push_back(variable);
+        }
+
+        m_instructions.push_back({
+            .type = ConditionInstructionType::Compare,
+            .variable = variable,
+            .condition = variableCondition,
+        });
+    } else {
+        // Anything that isn't a variable condition may depend on state that isn't tracked
+        m_cacheable = false;
+
+        // Negation is handled by the condition itself
+        m_instructions.push_back({
+            .type = ConditionInstructionType::Evaluate,
+            .condition = condition,
+        });
+        return;
+    }
+
+    if (condition->negate()) {
+        m_instructions.push_back({
+            .type = ConditionInstructionType::Not,
+        });
+    }
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace libinputactions
+{
+
+class Condition;
+class Variable;
+
+enum class ConditionInstructionType
+{
+    /**
+     * Sets the result to the constant.
+     */
+    Constant,
+    /**
+     * Compares the variable using the variable condition and sets the result.
+     */
+    Compare,
+    /**
+     * Evaluates a condition that can't be compiled and sets the result.
+     */
+    Evaluate,
+    /**
+     * Negates the result.
+     */
+    Not,
+    /**
+     * Jumps to the target instruction if the result is false.
+     */
+    JumpIfFalse,
+    /**
+     * Jumps to the target instruction if the result is true.
+     */
+    JumpIfTrue
+};
+
+struct ConditionInstruction
+{
+    ConditionInstructionType type;
+
+    bool constant{};
+    uint32_t target{};
+
+    Variable *variable{};
+    const Condition *condition{};
+};
+
+/**
+ * A condition tree compiled into a flat list of instructions that are evaluated in a loop. Variables are resolved once
+ * during compilation and groups are turned into short-circuit jumps, with conditions ordered by their cost.
+ *
+ * If the program only reads variables, the result is cached until the version of any of the variables read by the last
+ * evaluation changes.
+ */
+class ConditionProgram
+{
+public:
+    /**
+     * @param condition The condition to compile, kept alive by the program. Variables must be registered at this point.
+     */
+    explicit ConditionProgram(const std::shared_ptr<const Condition> &condition);
+
+    bool evaluate() const;
+
+    const std::vector<ConditionInstruction> &instructions() const;
+    /**
+     * @return Variables read by the program.
+     */
+    const std::vector<Variable *> &dependencies() const;
+
+private:
+    void compile(const Condition *condition);
+    bool run() const;
+
+    std::shared_ptr<const Condition> m_condition;
+    std::vector<ConditionInstruction> m_instructions;
+
+    std::vector<Variable *> m_dependencies;
+    /**
+     * Whether the result depends only on m_dependencies.
+     */
+    bool m_cacheable = true;
+    struct ReadVersion
+    {
+        Variable *variable;
+        uint64_t version;
+    };
+    /**
+     * Versions of the variables read by the last run, in the order they were read.
+     */
+    mutable std::vector<ReadVersion> m_readVersions;
+    mutable std::optional<bool> m_result;
+};
+
+}
\ No newline at end of file
@@ -18,8 +18,10 @@
 
 #include "VariableCondition.h"
 #include "ConditionGroup.h"
+#include "VariablePatternMatcher.h"
 #include <QLoggingCategory>
 #include <QRegularExpression>
+#include <algorithm>
 #include <libinputactions/variables/Variable.h>
 #include <libinputactions/variables/VariableManager.h>
 
@@ -33,6 +35,19 @@ VariableCondition::VariableCondition(const QString &variableName, const std::vec
     , m_values(values)
     , m_comparisonOperator(comparisonOperator)
 {
+    g_variableManager->markUsed(m_variableName);
+
+    const auto isString = [](const auto &value) {
+        return value.type() == typeid(QString);
+    };
+    if (m_comparisonOperator == ComparisonOperator::OneOf && !m_values.empty() && std::ranges::all_of(m_values, isString)) {
+        m_stringValues = std::unordered_set<QString>();
+        for (const auto &value : m_values) {
+            m_stringValues->insert(std::any_cast<QString>(value));
+        }
+    } else if (m_comparisonOperator == ComparisonOperator::Regex && !m_values.empty() && isString(m_values[0])) {
+        m_regex = QRegularExpression(std::any_cast<QString>(m_values[0]));
+    }
 }
 
 VariableCondition::VariableCondition(const QString &variableName, const std::any &value, ComparisonOperator comparisonOperator)
@@ -40,6 +55,55 @@ VariableCondition::VariableCondition(const QString &variableName, const std::any
 {
 }
 
+void VariableCondition::setPatternMatcher(const std::shared_ptr<VariablePatternMatcher> &matcher, size_t index)
+{
+    if (m_comparisonOperator != ComparisonOperator::Regex) {
+        return;
+    }
+    m_patternMatcher = matcher;
+    m_patternIndex = index;
+}
+
+const QString &VariableCondition::variableName() const
+{
+    return m_variableName;
+}
+
+const std::vector<std::any> &VariableCondition::values() const
+{
+    return m_values;
+}
+
+const ComparisonOperator &VariableCondition::comparisonOperator() const
+{
+    return m_comparisonOperator;
+}
+
+uint32_t VariableCondition::cost() const
+{
+    const auto variable = g_variableManager->getVariable(m_variableName);
+    if (!variable) {
+        return 0;
+    }
+
+    auto cost = variable->cost();
+    switch (m_comparisonOperator) {
+        case ComparisonOperator::OneOf:
+            cost += m_values.size();
+            break;
+        case ComparisonOperator::Contains:
+            cost += 2;
+            break;
+        case ComparisonOperator::Regex:
+            cost += 20;
+            break;
+        default:
+            cost += 1;
+            break;
+    }
+    return cost;
+}
+
 bool VariableCondition::satisfiedInternal() const
 {
     const auto variable = g_variableManager->getVariable(m_variableName);
@@ -47,7 +111,31 @@ bool VariableCondition::satisfiedInternal() const
         qCWarning(INPUTACTIONS_CONDITION_VARIABLE).noquote() << QString("Failed to get variable %1, assuming the condition is satisfied.").arg(m_variableName);
         return true;
     }
-    return variable->operations()->compare(m_values, m_comparisonOperator);
+    return compare(variable);
+}
+
+bool VariableCondition::compare(const Variable *variable) const
+{
+    const auto generation = ConditionEvaluationScope::generation();
+    if (generation && generation == m_memoizedGeneration) {
+        return m_memoizedResult;
+    }
+
+    bool result{};
+    if (m_patternMatcher) {
+        result = m_patternMatcher->matches(m_patternIndex);
+    } else if (m_stringValues || m_regex) {
+        const auto value = variable->get();
+        if (value.type() == typeid(QString)) {
+            const auto &string = std::any_cast<const QString &>(value);
+            result = m_stringValues ? m_stringValues->contains(string) : m_regex->match(string).hasMatch();
+        }
+    } else {
+        result = variable->operations()->compare(m_values, m_comparisonOperator);
+    }
+    m_memoizedGeneration = generation;
+    m_memoizedResult = result;
+    return result;
 }
 
 }
\ No newline at end of file
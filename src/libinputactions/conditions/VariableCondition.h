@@ -19,13 +19,19 @@
 #pragma once
 
 #include "Condition.h"
+#include <QRegularExpression>
 #include <QString>
 #include <any>
+#include <memory>
+#include <optional>
+#include <unordered_set>
 
 namespace libinputactions
 {
 
 enum class ComparisonOperator;
+class Variable;
+class VariablePatternMatcher;
 
 /**
  * If a non-existent variable is used, the condition will always be satisfied.
@@ -36,6 +42,29 @@ public:
     VariableCondition(const QString &variableName, const std::vector<std::any> &values, ComparisonOperator comparisonOperator);
     VariableCondition(const QString &variableName, const std::any &value, ComparisonOperator comparisonOperator);
 
+    const QString &variableName() const;
+    const std::vector<std::any> &values() const;
+    const ComparisonOperator &comparisonOperator() const;
+
+    /**
+     * @return The cost of reading the variable and the cost of the comparison.
+     */
+    uint32_t cost() const override;
+
+    /**
+     * Compares the value of the variable without looking it up, ignoring negation. The result is memoized for the
+     * current ConditionEvaluationScope.
+     * @param variable The variable this condition refers to.
+     */
+    bool compare(const Variable *variable) const;
+
+    /**
+     * Makes the condition use a matcher shared with other conditions instead of its own regular expression. Only
+     * applies if the operator is Regex.
+     * @param index Index of this condition's pattern in the matcher.
+     */
+    void setPatternMatcher(const std::shared_ptr<VariablePatternMatcher> &matcher, size_t index);
+
 protected:
     bool satisfiedInternal() const override;
 
@@ -43,6 +72,20 @@ private:
     QString m_variableName;
     std::vector<std::any> m_values;
     ComparisonOperator m_comparisonOperator;
+
+    /**
+     * Set if the operator is OneOf and all values are strings.
+     */
+    std::optional<std::unordered_set<QString>> m_stringValues;
+    /**
+     * Set if the operator is Regex and the value is a string.
+     */
+    std::optional<QRegularExpression> m_regex;
+    std::shared_ptr<VariablePatternMatcher> m_patternMatcher;
+    size_t m_patternIndex{};
+
+    mutable uint64_t m_memoizedGeneration{};
+    mutable bool m_memoizedResult{};
 };
 
 }
\ No newline at end of file
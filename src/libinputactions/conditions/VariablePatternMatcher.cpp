@@ -0,0 +1,139 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "VariablePatternMatcher.h"
+#include "Condition.h"
+#include <algorithm>
+#include <libinputactions/variables/Variable.h>
+
+namespace libinputactions
+{
+
+VariablePatternMatcher::VariablePatternMatcher(const Variable *variable)
+    : m_variable(variable)
+{
+}
+
+size_t VariablePatternMatcher::add(const QString &pattern)
+{
+    for (size_t i = 0; i < m_patterns.size(); i++) {
+        if (m_patterns[i].pattern() == pattern) {
+            return i;
+        }
+    }
+
+    QRegularExpression regex(pattern);
+    m_combinable.push_back(combinable(regex));
+    m_patterns.push_back(std::move(regex));
+    m_results.push_back(false);
+    m_combinedPatternOutdated = true;
+    return m_patterns.size() - 1;
+}
+
+bool VariablePatternMatcher::matches(size_t index)
+{
+    const auto generation = ConditionEvaluationScope::generation();
+    if (!generation) {
+        return match(index);
+    }
+
+    // Matching all patterns is only worth it once another pattern is evaluated in the same scope
+    if (generation != m_generation) {
+        m_generation = generation;
+        m_matchedIndex = index;
+        m_updated = false;
+        m_results[index] = match(index);
+    } else if (!m_updated && m_matchedIndex != index) {
+        update();
+        m_updated = true;
+    }
+    return m_results[index];
+}
+
+bool VariablePatternMatcher::match(size_t index) const
+{
+    const auto value = m_variable->get();
+    return value.type() == typeid(QString) && m_patterns[index].match(std::any_cast<const QString &>(value)).hasMatch();
+}
+
+void VariablePatternMatcher::update()
+{
+    std::ranges::fill(m_results, false);
+    const auto value = m_variable->get();
+    if (value.type() != typeid(QString)) {
+        return;
+    }
+    const auto &string = std::any_cast<const QString &>(value);
+
+    if (m_combinedPatternOutdated) {
+        buildCombinedPattern();
+    }
+    QRegularExpressionMatch combinedMatch;
+    if (m_combinedPattern) {
+        combinedMatch = m_combinedPattern->match(string);
+    }
+    for (size_t i = 0; i < m_patterns.size(); i++) {
+        if (m_combinedPattern && m_combinedGroups[i] != -1) {
+            m_results[i] = combinedMatch.capturedStart(m_combinedGroups[i]) != -1;
+            continue;
+        }
+        m_results[i] = m_patterns[i].match(string).hasMatch();
+    }
+}
+
+void VariablePatternMatcher::buildCombinedPattern()
+{
+    m_combinedPatternOutdated = false;
+    m_combinedPattern = {};
+    m_combinedGroups.assign(m_patterns.size(), -1);
+
+    // Each lookahead searches the entire value for its pattern and is skipped if the pattern does not match, so the
+    // combined pattern always matches at the start
+    QString combined = "^";
+    size_t count{};
+    int group = 1;
+    for (size_t i = 0; i < m_patterns.size(); i++) {
+        if (!m_combinable[i]) {
+            continue;
+        }
+        combined += QString("(?=[\\s\\S]*?(%1))?").arg(m_patterns[i].pattern());
+        m_combinedGroups[i] = group;
+        group += 1 + m_patterns[i].captureCount();
+        count++;
+    }
+    if (count < 2) {
+        return;
+    }
+
+    QRegularExpression combinedPattern(combined);
+    if (!combinedPattern.isValid()) {
+        return;
+    }
+    combinedPattern.optimize();
+    m_combinedPattern = std::move(combinedPattern);
+}
+
+bool VariablePatternMatcher::combinable(const QRegularExpression &pattern)
+{
+    // Backreferences, named groups, recursion, conditionals and branch resets depend on the position of groups in the
+    // combined pattern, \Q may not be terminated, \K is not allowed in lookaheads
+    static const QRegularExpression unsafe(R"(\\[1-9gkKQ]|\(\?(P|'|<[A-Za-z]|R|[+-]?[0-9]|&|\(|\|))");
+    return pattern.isValid() && !unsafe.match(pattern.pattern()).hasMatch();
+}
+
+}
\ No newline at end of file
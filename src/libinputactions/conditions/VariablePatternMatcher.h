@@ -0,0 +1,94 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <optional>
+#include <vector>
+
+namespace libinputactions
+{
+
+class Variable;
+
+/**
+ * Matches the value of a string variable against all regular expressions that have been added to it at once. Patterns
+ * are combined into a single expression, in which each pattern is an optional lookahead with its own capturing group.
+ * The groups that captured something after one match are the patterns that matched.
+ *
+ * The first pattern evaluated in a ConditionEvaluationScope is matched alone. Results of all patterns are computed once
+ * another pattern is evaluated in the same scope.
+ */
+class VariablePatternMatcher
+{
+public:
+    VariablePatternMatcher(const Variable *variable);
+
+    /**
+     * @return Index of the pattern, identical patterns share the same index.
+     */
+    size_t add(const QString &pattern);
+
+    /**
+     * @return Whether the value of the variable matches the pattern at the specified index.
+     */
+    bool matches(size_t index);
+
+private:
+    /**
+     * Matches the pattern at the specified index alone.
+     */
+    bool match(size_t index) const;
+    /**
+     * Matches all patterns and stores the results.
+     */
+    void update();
+    void buildCombinedPattern();
+
+    /**
+     * @return Whether the pattern can be safely combined with others.
+     */
+    static bool combinable(const QRegularExpression &pattern);
+
+    const Variable *m_variable;
+
+    std::vector<QRegularExpression> m_patterns;
+    std::vector<bool> m_combinable;
+    std::optional<QRegularExpression> m_combinedPattern;
+    /**
+     * Index of the capturing group of each pattern in the combined pattern, -1 if the pattern is not a part of it.
+     */
+    std::vector<int> m_combinedGroups;
+    bool m_combinedPatternOutdated{};
+
+    std::vector<bool> m_results;
+    uint64_t m_generation{};
+    /**
+     * Index of the first pattern matched in the current scope.
+     */
+    size_t m_matchedIndex{};
+    /**
+     * Whether m_results contains the results of all patterns for the current scope.
+     */
+    bool m_updated{};
+};
+
+}
\ No newline at end of file
@@ -24,6 +24,12 @@ Q_LOGGING_CATEGORY(INPUTACTIONS_HANDLER_MOTION, "inputactions.handler.motion", Q
 namespace libinputactions
 {
 
+/**
+ * Speed thresholds are the distance per this interval. 10 ms matches the event rate of most touchpads, which is what the thresholds were originally
+ * defined for (average delta per event).
+ */
+static const std::chrono::microseconds SPEED_REFERENCE_INTERVAL = std::chrono::milliseconds(10);
+
 MotionTriggerHandler::MotionTriggerHandler()
 {
     registerTriggerEndHandler(TriggerType::Stroke, std::bind(&MotionTriggerHandler::strokeTriggerEndHandler, this));
@@ -35,25 +41,40 @@ MotionTriggerHandler::MotionTriggerHandler()
 }
 
 void MotionTriggerHandler::setSpeedThreshold(TriggerType type, qreal threshold, TriggerDirection directions)
+{
+    addSpeedThreshold({
+        .type = type,
+        .threshold = threshold,
+        .directions = directions,
+    });
+}
+
+void MotionTriggerHandler::setSpeedThresholdPerEvent(TriggerType type, qreal threshold, TriggerDirection directions)
+{
+    addSpeedThreshold({
+        .type = type,
+        .threshold = threshold,
+        .directions = directions,
+        .perEvent = true,
+    });
+}
+
+void MotionTriggerHandler::addSpeedThreshold(const TriggerSpeedThreshold &threshold)
 {
     for (auto it = m_speedThresholds.begin(); it != m_speedThresholds.end();) {
         auto thresholds = *it;
-        if (thresholds.type == type && thresholds.directions == directions) {
+        if (thresholds.type == threshold.type && thresholds.directions == threshold.directions) {
             it = m_speedThresholds.erase(it);
             continue;
         }
         it++;
     }
-    m_speedThresholds.push_back({
-        .type = type,
-        .threshold = threshold,
-        .directions = directions,
-    });
+    m_speedThresholds.push_back(threshold);
 }
 
-void MotionTriggerHandler::setSpeedInputEventsToSample(uint8_t events)
+void MotionTriggerHandler::setSpeedWindow(std::chrono::milliseconds value)
 {
-    m_inputEventsToSample = events;
+    m_speedWindow = value;
 }
 
 void MotionTriggerHandler::setSwipeDeltaMultiplier(qreal multiplier)
@@ -61,7 +82,7 @@ void MotionTriggerHandler::setSwipeDeltaMultiplier(qreal multiplier)
     m_swipeDeltaMultiplier = multiplier;
 }
 
-bool MotionTriggerHandler::handleMotion(const QPointF &delta)
+bool MotionTriggerHandler::handleMotion(const QPointF &delta, std::chrono::microseconds timestamp)
 {
     if (!hasActiveTriggers(TriggerType::StrokeSwipe)) {
         return false;
@@ -77,7 +98,7 @@ bool MotionTriggerHandler::handleMotion(const QPointF &delta)
 
     const auto deltaHypot = std::hypot(delta.x(), delta.y());
     TriggerSpeed speed{};
-    if (!determineSpeed(TriggerType::Swipe, deltaHypot, speed)) {
+    if (!determineSpeed(TriggerType::Swipe, deltaHypot, timestamp, speed)) {
         qCDebug(INPUTACTIONS_HANDLER_MOTION, "Event processed (type: Motion, status: DeterminingSpeed)");
         return true;
     }
@@ -135,7 +156,7 @@ bool MotionTriggerHandler::handleMotion(const QPointF &delta)
     return hasTriggers;
 }
 
-bool MotionTriggerHandler::determineSpeed(TriggerType type, qreal delta, TriggerSpeed &speed, TriggerDirection direction)
+bool MotionTriggerHandler::determineSpeed(TriggerType type, qreal delta, std::chrono::microseconds timestamp, TriggerSpeed &speed, TriggerDirection direction)
 {
     if (!m_isDeterminingSpeed) {
         if (m_speed) {
@@ -157,19 +178,39 @@ bool MotionTriggerHandler::determineSpeed(TriggerType type, qreal delta, Trigger
         return false;
     }
 
-    if (m_sampledInputEvents++ != m_inputEventsToSample) {
-        m_accumulatedAbsoluteSampledDelta += std::abs(delta);
-        qCDebug(INPUTACTIONS_HANDLER_MOTION).noquote() << QString("Determining speed (event: %1/%2, delta: %3/%4)")
-                                                              .arg(QString::number(m_sampledInputEvents),
-                                                                   QString::number(m_inputEventsToSample),
+    if (!m_speedSamplingStart) {
+        m_speedSamplingStart = timestamp;
+        return false;
+    }
+    m_sampledInputEvents++;
+    m_accumulatedAbsoluteSampledDelta += std::abs(delta);
+
+    const auto elapsed = timestamp - *m_speedSamplingStart;
+    auto threshold = speedThreshold->threshold;
+    if (speedThreshold->perEvent) {
+        // Convert using the average interval between the sampled events
+        threshold *= SPEED_REFERENCE_INTERVAL / (std::chrono::duration<qreal>(elapsed) / m_sampledInputEvents);
+    }
+    // Distance that must be travelled over the entire window for the motion to be fast
+    const auto windowThreshold = threshold * std::chrono::duration<qreal>(m_speedWindow) / SPEED_REFERENCE_INTERVAL;
+    if (m_accumulatedAbsoluteSampledDelta >= windowThreshold) {
+        // Fast regardless of any further motion
+        m_speed = speed = TriggerSpeed::Fast;
+    } else if (elapsed >= m_speedWindow) {
+        const auto velocity = m_accumulatedAbsoluteSampledDelta * SPEED_REFERENCE_INTERVAL / std::chrono::duration<qreal>(elapsed);
+        m_speed = speed = velocity >= threshold ? TriggerSpeed::Fast : TriggerSpeed::Slow;
+    } else {
+        qCDebug(INPUTACTIONS_HANDLER_MOTION).noquote() << QString("Determining speed (elapsed: %1/%2 ms, delta: %3/%4)")
+                                                              .arg(QString::number(elapsed.count() / 1000.0),
+                                                                   QString::number(m_speedWindow.count()),
                                                                    QString::number(m_accumulatedAbsoluteSampledDelta),
-                                                                   QString::number(speedThreshold->threshold));
+                                                                   QString::number(windowThreshold));
         return false;
     }
 
     m_isDeterminingSpeed = false;
-    m_speed = speed = (m_accumulatedAbsoluteSampledDelta / m_inputEventsToSample) >= speedThreshold->threshold ? TriggerSpeed::Fast : TriggerSpeed::Slow;
-    qCDebug(INPUTACTIONS_HANDLER_MOTION).noquote() << "Speed determined (speed: " << speed << ")";
+    qCDebug(INPUTACTIONS_HANDLER_MOTION).noquote().nospace() << "Speed determined (speed: " << speed << ", latency: " << elapsed.count() / 1000.0
+                                                             << " ms, events: " << m_sampledInputEvents + 1 << ")";
     return true;
 }
 
@@ -191,6 +232,7 @@ void MotionTriggerHandler::reset()
     m_currentSwipeDelta = {};
     m_speed = {};
     m_isDeterminingSpeed = false;
+    m_speedSamplingStart = {};
     m_sampledInputEvents = 0;
     m_accumulatedAbsoluteSampledDelta = 0;
     m_stroke.clear();
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "TriggerHandler.h"
+#include <chrono>
 #include <libinputactions/triggers/DirectionalMotionTrigger.h>
 
 Q_DECLARE_LOGGING_CATEGORY(INPUTACTIONS_HANDLER_MOTION)
@@ -38,6 +39,10 @@ struct TriggerSpeedThreshold
     TriggerType type;
     qreal threshold;
     uint32_t directions;
+    /**
+     * Whether the threshold is the average delta per event instead of the distance per 10 ms.
+     */
+    bool perEvent{};
 };
 
 /**
@@ -48,9 +53,22 @@ class MotionTriggerHandler : public TriggerHandler
 public:
     /**
      * Duplicate thresholds (same type and direction) will be replaced.
+     * @param threshold Minimum distance travelled per 10 ms for the motion to be fast. Before speed was determined over a time window, this was the average
+     * delta per event, which is only equivalent for devices that send an event every 10 ms, such as most touchpads.
      */
     void setSpeedThreshold(TriggerType type, qreal threshold, TriggerDirection directions = UINT32_MAX);
-    void setSpeedInputEventsToSample(uint8_t events);
+    /**
+     * Sets a threshold in the unit used before speed was determined over a time window. It is converted to the distance per 10 ms using the event rate
+     * measured while determining speed.
+     * @param threshold Minimum average delta per event for the motion to be fast.
+     * @see setSpeedThreshold
+     */
+    void setSpeedThresholdPerEvent(TriggerType type, qreal threshold, TriggerDirection directions = UINT32_MAX);
+    /**
+     * @param value Maximum amount of time to sample motion for before determining the speed. Motion that is fast enough to exceed the threshold over the
+     * entire window is classified as fast immediately.
+     */
+    void setSpeedWindow(std::chrono::milliseconds value);
 
     /**
      * Used in input actions, as KWin doesn't provide accelerated deltas for gestures. Temporary workaround.
@@ -62,24 +80,31 @@ protected:
 
     /**
      * Does nothing if there are no active pinch or rotate triggers.
+     * @param timestamp Timestamp of the input event.
      * @return Whether there are any active pinch or rotate triggers.
      */
-    bool handleMotion(const QPointF &delta);
+    bool handleMotion(const QPointF &delta, std::chrono::microseconds timestamp);
 
     /**
+     * Determines speed from the average velocity of motion over the speed window. Speed thresholds are the distance per SPEED_REFERENCE_INTERVAL, making
+     * them independent of the device's event rate.
+     *
      * If false is returned, speed is being determined and methods processing triggers must also return true
      * immediately and not update triggers.
      * @param delta The delta of the individual input event.
+     * @param timestamp Timestamp of the input event.
      * @param speed Set to the speed once it is determined.
      * @return Whether speed is necessary and has been determined.
      * @see setSpeedThreshold
+     * @see setSpeedWindow
      */
-    bool determineSpeed(TriggerType type, qreal delta, TriggerSpeed &speed, TriggerDirection direction = UINT32_MAX);
+    bool determineSpeed(TriggerType type, qreal delta, std::chrono::microseconds timestamp, TriggerSpeed &speed, TriggerDirection direction = UINT32_MAX);
 
     virtual void triggerActivating(const Trigger *trigger) override;
     void reset() override;
 
 private:
+    void addSpeedThreshold(const TriggerSpeedThreshold &threshold);
     void strokeTriggerEndHandler();
 
     Axis m_currentSwipeAxis = Axis::None;
@@ -87,8 +112,12 @@ private:
     qreal m_swipeDeltaMultiplier = 1.0;
 
     bool m_isDeterminingSpeed = false;
-    uint8_t m_inputEventsToSample = 3;
-    uint8_t m_sampledInputEvents = 0;
+    std::chrono::milliseconds m_speedWindow{30};
+    /**
+     * Timestamp of the first sampled event. Its delta is not sampled, as the time over which it was accumulated is unknown.
+     */
+    std::optional<std::chrono::microseconds> m_speedSamplingStart;
+    uint32_t m_sampledInputEvents = 0;
     qreal m_accumulatedAbsoluteSampledDelta = 0;
     std::optional<TriggerSpeed> m_speed;
     std::vector<TriggerSpeedThreshold> m_speedThresholds;
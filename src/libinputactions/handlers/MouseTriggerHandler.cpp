@@ -36,6 +36,9 @@ MouseTriggerHandler::MouseTriggerHandler()
 
     m_motionTimeoutTimer.setTimerType(Qt::TimerType::PreciseTimer);
     m_motionTimeoutTimer.setSingleShot(true);
+
+    // Mice report much more often than touchpads. Equivalent to the previous per-event threshold of 20 at 500 Hz.
+    setSpeedThreshold(TriggerType::Swipe, 100);
 }
 
 bool MouseTriggerHandler::handleEvent(const InputEvent *event)
@@ -153,8 +156,10 @@ bool MouseTriggerHandler::handleEvent(const PointerButtonEvent *event)
         const auto block = m_blockedMouseButtons.contains(nativeButton);
         if (m_blockedMouseButtons.removeAll(nativeButton) && !m_hadTriggerSincePress) {
             qCDebug(INPUTACTIONS_HANDLER_MOUSE).nospace() << "Mouse button pressed and released (button: " << nativeButton << ")";
+            g_inputEmitter->beginBatch();
             g_inputEmitter->mouseButton(nativeButton, true);
             g_inputEmitter->mouseButton(nativeButton, false);
+            g_inputEmitter->commit();
         }
         if (m_blockedMouseButtons.empty()) {
             m_hadTriggerSincePress = false;
@@ -195,7 +200,7 @@ bool MouseTriggerHandler::handleMotionEvent(const MotionEvent *event)
     }
 
     const auto hadActiveGestures = hasActiveTriggers(TriggerType::StrokeSwipe);
-    const auto block = handleMotion(delta);
+    const auto block = handleMotion(delta, event->timestamp());
     if (hadActiveGestures && !hasActiveTriggers(TriggerType::StrokeSwipe)) {
         qCDebug(INPUTACTIONS_HANDLER_MOUSE, "Mouse motion gesture ended/cancelled during motion");
         // Swipe gesture cancelled due to wrong speed or direction
@@ -283,10 +288,12 @@ bool MouseTriggerHandler::shouldBlockMouseButton(Qt::MouseButton button)
 
 void MouseTriggerHandler::pressBlockedMouseButtons()
 {
+    g_inputEmitter->beginBatch();
     for (const auto &button : m_blockedMouseButtons) {
         g_inputEmitter->mouseButton(button, true);
         qCDebug(INPUTACTIONS_HANDLER_MOUSE).nospace() << "Mouse button unblocked (button: " << button << ")";
     }
+    g_inputEmitter->commit();
     m_blockedMouseButtons.clear();
 }
 
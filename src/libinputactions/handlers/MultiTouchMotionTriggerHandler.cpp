@@ -23,7 +23,7 @@ Q_LOGGING_CATEGORY(INPUTACTIONS_HANDLER_MULTITOUCH, "inputactions.handler.multit
 namespace libinputactions
 {
 
-bool MultiTouchMotionTriggerHandler::handlePinch(qreal scale, qreal angleDelta)
+bool MultiTouchMotionTriggerHandler::handlePinch(qreal scale, qreal angleDelta, std::chrono::microseconds timestamp)
 {
     if (!hasActiveTriggers(TriggerType::PinchRotate)) {
         return false;
@@ -70,7 +70,7 @@ bool MultiTouchMotionTriggerHandler::handlePinch(qreal scale, qreal angleDelta)
     }
 
     TriggerSpeed speed{};
-    if (!determineSpeed(type, delta, speed, direction)) {
+    if (!determineSpeed(type, delta, timestamp, speed, direction)) {
         qCDebug(INPUTACTIONS_HANDLER_MULTITOUCH, "Event processed (type: Pinch, status: DeterminingSpeed)");
         return true;
     }
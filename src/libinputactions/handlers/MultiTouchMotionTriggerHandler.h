@@ -43,9 +43,10 @@ protected:
 
     /**
      * Does nothing if there are no active pinch or rotate triggers.
+     * @param timestamp Timestamp of the input event.
      * @return Whether there are any active pinch or rotate triggers.
      */
-    bool handlePinch(qreal scale, qreal angleDelta);
+    bool handlePinch(qreal scale, qreal angleDelta, std::chrono::microseconds timestamp);
 
     void reset() override;
 
@@ -23,9 +23,35 @@ namespace libinputactions
 {
 
 TouchpadTriggerHandler::TouchpadTriggerHandler()
+    : m_fingersVariable(g_variableManager->getVariable(BuiltinVariables::Fingers))
+    , m_thumbPositionVariable(g_variableManager->getVariable(BuiltinVariables::ThumbPositionPercentage))
+    , m_thumbPresentVariable(g_variableManager->getVariable(BuiltinVariables::ThumbPresent))
 {
     m_clickTimeoutTimer.setTimerType(Qt::TimerType::PreciseTimer);
     m_clickTimeoutTimer.setSingleShot(true);
+
+    m_fingerVariables.reserve(s_fingerVariableCount);
+    for (auto i = 1; i <= s_fingerVariableCount; i++) {
+        m_fingerVariables.push_back({
+            .position = g_variableManager->getVariable<QPointF>(QString("finger_%1_position_percentage").arg(i)).value(),
+            .pressure = g_variableManager->getVariable<qreal>(QString("finger_%1_pressure").arg(i)).value(),
+        });
+    }
+
+    m_variableRefresher = g_variableManager->addRefresher([this] {
+        if (m_skippedSlots.empty()) {
+            return;
+        }
+        updateFingerVariables(m_skippedSlots, ~0ull, m_skippedThumbPressureRange);
+        m_skippedSlots = {};
+    });
+}
+
+TouchpadTriggerHandler::~TouchpadTriggerHandler()
+{
+    if (g_variableManager) {
+        g_variableManager->removeRefresher(m_variableRefresher);
+    }
 }
 
 bool TouchpadTriggerHandler::handleEvent(const InputEvent *event)
@@ -85,7 +111,7 @@ bool TouchpadTriggerHandler::handleEvent(const TouchpadGestureLifecyclePhaseEven
 {
     switch (event->phase()) {
         case TouchpadGestureLifecyclePhase::Begin:
-            g_variableManager->getVariable(BuiltinVariables::Fingers)->set(event->fingers());
+            m_fingersVariable->set(event->fingers());
             {
                 // Delay press gesture activation if there is a click gesture
                 TriggerActivationEvent activationEvent;
@@ -120,44 +146,65 @@ bool TouchpadTriggerHandler::handleEvent(const TouchpadGestureLifecyclePhaseEven
 
 bool TouchpadTriggerHandler::handleEvent(const TouchpadPinchEvent *event)
 {
-    return handlePinch(event->scale(), event->angleDelta());
+    return handlePinch(event->scale(), event->angleDelta(), event->timestamp());
 }
 
 bool TouchpadTriggerHandler::handleEvent(const TouchpadSlotEvent *event)
 {
     m_usesLibevdevBackend = true;
 
-    auto thumbPresent = g_variableManager->getVariable(BuiltinVariables::ThumbPresent);
-    auto thumbPosition = g_variableManager->getVariable(BuiltinVariables::ThumbPositionPercentage);
-    bool hasThumb{};
+    const auto updateFingers = std::ranges::any_of(m_fingerVariables, [](const auto &variables) {
+        return variables.position.used() || variables.pressure.used();
+    });
+    if (!updateFingers && !m_thumbPositionVariable->used() && !m_thumbPresentVariable->used()) {
+        // Slots changed in the meantime would otherwise be missed once the variables become used
+        m_updateAllSlots = true;
+        m_skippedSlots = event->fingerSlots();
+        m_skippedThumbPressureRange = event->sender()->properties().thumbPressureRange();
+        return false;
+    }
 
-    for (auto i = 0; i < std::min(static_cast<uint8_t>(event->fingerSlots().size()), s_fingerVariableCount); i++) {
-        const auto &slot = event->fingerSlots()[i];
-        const auto fingerVariableNumber = i + 1;
+    auto changedSlots = event->changedSlots();
+    if (m_updateAllSlots) {
+        changedSlots = ~0ull;
+        m_updateAllSlots = false;
+    }
+    m_skippedSlots = {};
 
-        auto position = g_variableManager->getVariable<QPointF>(QString("finger_%1_position_percentage").arg(fingerVariableNumber));
-        auto pressure = g_variableManager->getVariable<qreal>(QString("finger_%1_pressure").arg(fingerVariableNumber));
+    updateFingerVariables(event->fingerSlots(), changedSlots, event->sender()->properties().thumbPressureRange());
+    return false;
+}
 
+void TouchpadTriggerHandler::updateFingerVariables(std::span<const TouchpadSlot> slots, uint64_t changedSlots, const Range<uint32_t> &thumbPressureRange)
+{
+    bool hasThumb{};
+    for (size_t i = 0; i < std::min(slots.size(), m_fingerVariables.size()); i++) {
+        const auto &slot = slots[i];
         if (!slot.active) {
-            position->set({});
-            pressure->set({});
+            if (changedSlots & (1ull << i)) {
+                auto &variables = m_fingerVariables[i];
+                variables.position.set({});
+                variables.pressure.set({});
+            }
             continue;
         }
 
-        if (event->sender()->properties().thumbPressureRange().contains(slot.pressure)) {
+        if (thumbPressureRange.contains(slot.pressure)) {
             hasThumb = true;
-            thumbPresent->set(true);
-            thumbPosition->set(slot.position);
+            m_thumbPresentVariable->set(true);
+            m_thumbPositionVariable->set(slot.position);
+        }
+        if (changedSlots & (1ull << i)) {
+            auto &variables = m_fingerVariables[i];
+            variables.position.set(slot.position);
+            variables.pressure.set(slot.pressure);
         }
-        position->set(slot.position);
-        pressure->set(slot.pressure);
     }
 
     if (!hasThumb) {
-        thumbPresent->set(false);
-        thumbPosition->set({});
+        m_thumbPresentVariable->set(false);
+        m_thumbPositionVariable->set({});
     }
-    return false;
 }
 
 bool TouchpadTriggerHandler::handleScrollEvent(const MotionEvent *event)
@@ -170,12 +217,12 @@ bool TouchpadTriggerHandler::handleScrollEvent(const MotionEvent *event)
 
     if (!m_scrollInProgress) {
         if (!m_usesLibevdevBackend) {
-            g_variableManager->getVariable(BuiltinVariables::Fingers)->set(2);
+            m_fingersVariable->set(2);
         }
         m_scrollInProgress = true;
         activateTriggers(TriggerType::StrokeSwipe);
     }
-    if (handleMotion(event->delta())) {
+    if (handleMotion(event->delta(), event->timestamp())) {
         return true;
     }
     return false;
@@ -183,7 +230,7 @@ bool TouchpadTriggerHandler::handleScrollEvent(const MotionEvent *event)
 
 bool TouchpadTriggerHandler::handleSwipeEvent(const MotionEvent *event)
 {
-    return handleMotion(event->delta());
+    return handleMotion(event->delta(), event->timestamp());
 }
 
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <libinputactions/handlers/MultiTouchMotionTriggerHandler.h>
+#include <libinputactions/variables/VariableManager.h>
 
 namespace libinputactions
 {
@@ -35,6 +36,7 @@ class TouchpadTriggerHandler : public MultiTouchMotionTriggerHandler
 {
 public:
     TouchpadTriggerHandler();
+    ~TouchpadTriggerHandler() override;
 
     bool handleEvent(const InputEvent *event) override;
 
@@ -55,10 +57,40 @@ private:
      */
     bool handleScrollEvent(const MotionEvent *event);
     bool handleSwipeEvent(const MotionEvent *event);
+    /**
+     * Sets the finger and thumb variables from the specified slots.
+     * @param changedSlots Bitmask of slots whose finger variables should be updated.
+     */
+    void updateFingerVariables(std::span<const TouchpadSlot> slots, uint64_t changedSlots, const Range<uint32_t> &thumbPressureRange);
+
+    struct FingerVariables
+    {
+        VariableWrapper<QPointF> position;
+        VariableWrapper<qreal> pressure;
+    };
+    /**
+     * Bound once, index is the slot.
+     */
+    std::vector<FingerVariables> m_fingerVariables;
+    std::optional<VariableWrapper<qreal>> m_fingersVariable;
+    std::optional<VariableWrapper<QPointF>> m_thumbPositionVariable;
+    std::optional<VariableWrapper<bool>> m_thumbPresentVariable;
 
     bool m_scrollInProgress{};
 
     bool m_usesLibevdevBackend{};
+    /**
+     * Whether the next slot event should update the variables of all slots and not only the changed ones.
+     */
+    bool m_updateAllSlots = true;
+    /**
+     * Slots of the backend that sent the last event whose variables were not updated because they are unused, used to
+     * refresh them. Not copied, the backend keeps them up to date and sends an event without slots before they are
+     * destroyed. Empty if nothing was skipped.
+     */
+    std::span<const TouchpadSlot> m_skippedSlots;
+    Range<uint32_t> m_skippedThumbPressureRange;
+    uint64_t m_variableRefresher{};
     bool m_clicked{};
 
     uint32_t m_clickTimeout = 200;
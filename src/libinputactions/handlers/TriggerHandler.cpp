@@ -97,6 +97,7 @@ bool TriggerHandler::activateTriggers(TriggerTypes types, const TriggerActivatio
 
     for (auto &trigger : triggers(types, event)) {
         triggerActivating(trigger);
+        trigger->prefetchValues();
         m_activeTriggers.push_back(trigger);
         qCDebug(INPUTACTIONS_HANDLER_TRIGGER).noquote() << QString("Trigger activated (id: %1)").arg(trigger->id());
     }
@@ -245,6 +246,9 @@ void TriggerHandler::cancelTriggers(Trigger *except)
 
 std::vector<Trigger *> TriggerHandler::triggers(TriggerTypes types, const TriggerActivationEvent *event)
 {
+    // Triggers often share conditions
+    const ConditionEvaluationScope scope;
+
     std::vector<Trigger *> result;
     for (auto &trigger : m_triggers) {
         if (!(types & trigger->type()) || !trigger->canActivate(event)) {
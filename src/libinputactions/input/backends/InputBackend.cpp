@@ -34,9 +34,19 @@ InputBackend::InputBackend()
     QObject::connect(&m_strokeRecordingTimeoutTimer, &QTimer::timeout, [this] {
         finishStrokeRecording();
     });
+    m_variableRefresher = g_variableManager->addRefresher([this] {
+        if (m_lastPointingDevice) {
+            g_variableManager->getVariable(BuiltinVariables::DeviceName)->set(m_lastPointingDevice->name());
+        }
+    });
 }
 
-InputBackend::~InputBackend() = default;
+InputBackend::~InputBackend()
+{
+    if (g_variableManager) {
+        g_variableManager->removeRefresher(m_variableRefresher);
+    }
+}
 
 void InputBackend::addEventHandler(std::unique_ptr<InputEventHandler> handler)
 {
@@ -55,6 +65,11 @@ void InputBackend::poll()
 void InputBackend::addCustomDeviceProperties(const QString &name, const InputDeviceProperties &properties)
 {
     m_customDeviceProperties[name] = properties;
+    for (const auto &[device, detectedProperties] : m_devices) {
+        if (device->name() == name) {
+            applyCustomDeviceProperties(device, detectedProperties);
+        }
+    }
 }
 
 void InputBackend::initialize()
@@ -71,17 +86,49 @@ void InputBackend::reset()
 {
     m_handlers.clear();
     m_customDeviceProperties.clear();
+    for (const auto &[device, detectedProperties] : m_devices) {
+        applyCustomDeviceProperties(device, detectedProperties);
+    }
+}
+
+void InputBackend::addDevice(InputDevice *device)
+{
+    deviceAdded(device);
+    const auto &detectedProperties = m_devices[device] = device->properties();
+    applyCustomDeviceProperties(device, detectedProperties);
+}
+
+void InputBackend::removeDevice(InputDevice *device)
+{
+    if (m_lastPointingDevice == device) {
+        m_lastPointingDevice = nullptr;
+    }
+    deviceRemoved(device);
+    m_devices.erase(device);
+}
+
+void InputBackend::redetectDevices()
+{
+    for (auto &[device, detectedProperties] : m_devices) {
+        deviceRemoved(device);
+        device->properties() = {};
+        deviceAdded(device);
+        detectedProperties = device->properties();
+        applyCustomDeviceProperties(device, detectedProperties);
+    }
+}
+
+void InputBackend::applyCustomDeviceProperties(InputDevice *device, const InputDeviceProperties &detectedProperties)
+{
+    device->properties() = detectedProperties;
+    if (const auto it = m_customDeviceProperties.find(device->name()); it != m_customDeviceProperties.end()) {
+        device->properties().apply(it->second);
+    }
 }
 
 void InputBackend::deviceAdded(InputDevice *device)
 {
     qCDebug(INPUTACTIONS).noquote().nospace() << "Device added (name: " << device->name() << ")";
-    for (const auto &[name, properties] : m_customDeviceProperties) {
-        if (name == device->name()) {
-            device->properties().apply(properties);
-            break;
-        }
-    }
 }
 
 void InputBackend::deviceRemoved(const InputDevice *device)
@@ -99,7 +146,10 @@ bool InputBackend::handleEvent(const InputEvent *event)
         g_keyboard->handleEvent(static_cast<const KeyboardKeyEvent *>(event));
     }
     if (event->sender()->type() != InputDeviceType::Keyboard) {
-        g_variableManager->getVariable(BuiltinVariables::DeviceName)->set(event->sender()->name());
+        m_lastPointingDevice = event->sender();
+        if (auto deviceNameVariable = g_variableManager->getVariable(BuiltinVariables::DeviceName); deviceNameVariable->used()) {
+            deviceNameVariable->set(event->sender()->name());
+        }
     }
 
     for (const auto &handler : m_handlers) {
@@ -110,6 +160,14 @@ bool InputBackend::handleEvent(const InputEvent *event)
     return false;
 }
 
+bool InputBackend::handleEvent(InputEvent *event, std::chrono::microseconds timestamp)
+{
+    if (timestamp.count()) {
+        event->setTimestamp(timestamp);
+    }
+    return handleEvent(static_cast<const InputEvent *>(event));
+}
+
 void InputBackend::finishStrokeRecording()
 {
     m_isRecordingStroke = false;
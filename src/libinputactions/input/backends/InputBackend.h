@@ -19,6 +19,7 @@
 #pragma once
 
 #include <QTimer>
+#include <chrono>
 
 namespace libinputactions
 {
@@ -32,12 +33,13 @@ class Stroke;
 /**
  * Collects input events and forwards them to event handlers.
  *
- * Primary backends are responsible for managing (adding and removing) devices. Complementary backends are only allowed to set properties when a device is
- * being added.
+ * Primary backends are responsible for managing (adding and removing) devices using addDevice and removeDevice. Complementary backends are only allowed to
+ * set properties when a device is being added.
  *
  * Backends must ignore events when m_ignoreEvents is set to true.
  *
- * To re-initialize the backend, call reset() and then initialize().
+ * To reconfigure the backend, call reset(), add event handlers and custom device properties, and then call initialize(). Devices are kept across
+ * reconfigurations.
  * @see reset
  * @see initialize
  */
@@ -58,13 +60,13 @@ public:
     virtual void poll();
 
     /**
-     * @param properties Custom properties that will override the ones that were detected automatically.
-     * @remark Custom properties will not be applied to devices that have already been added to the backend.
+     * @param properties Custom properties that will override the ones that were detected automatically. Applied to devices that have already been added as
+     * well.
      */
     void addCustomDeviceProperties(const QString &name, const InputDeviceProperties &properties);
 
     /**
-     * Detects and adds devices.
+     * Detects and adds devices that have not been added yet.
      */
     virtual void initialize();
 
@@ -75,14 +77,24 @@ public:
     void recordStroke(const std::function<void(const Stroke &stroke)> &callback);
 
     /**
-     * Removes all event handlers, devices and custom properties. Backend must be initialized in order to be used again.
+     * Removes all event handlers and custom properties. Devices are kept, with their properties restored to the detected ones.
      * @see initialize
      */
-    virtual void reset();
+    void reset();
 
 protected:
     InputBackend();
 
+    /**
+     * Calls deviceAdded and then applies custom properties.
+     */
+    void addDevice(InputDevice *device);
+    void removeDevice(InputDevice *device);
+    /**
+     * Removes and adds all devices again, so that backends can detect their properties again.
+     */
+    void redetectDevices();
+
     /**
      * Backends should add device properties in this method.
      */
@@ -94,6 +106,10 @@ protected:
      * @returns Whether the event should be blocked.
      */
     bool handleEvent(const InputEvent *event);
+    /**
+     * @param timestamp Overrides the timestamp of the event, unless zero.
+     */
+    bool handleEvent(InputEvent *event, std::chrono::microseconds timestamp);
 
     void finishStrokeRecording();
 
@@ -105,10 +121,24 @@ protected:
     QTimer m_strokeRecordingTimeoutTimer;
 
 private:
+    /**
+     * Overwrites the properties of the device with the detected ones and applies custom properties.
+     */
+    void applyCustomDeviceProperties(InputDevice *device, const InputDeviceProperties &detectedProperties);
+
     std::function<void(const Stroke &stroke)> m_strokeCallback;
 
-    std::vector<std::unique_ptr<InputDevice>> m_devices;
+    /**
+     * Device -> properties detected by backends, without custom properties applied.
+     */
+    std::map<InputDevice *, InputDeviceProperties> m_devices;
     std::map<QString, InputDeviceProperties> m_customDeviceProperties;
+
+    /**
+     * The sender of the last non-keyboard event, used to set device_name when it is refreshed.
+     */
+    const InputDevice *m_lastPointingDevice{};
+    uint64_t m_variableRefresher{};
 };
 
 inline std::unique_ptr<InputBackend> g_inputBackend;
@@ -18,6 +18,7 @@
 
 #include "LibevdevComplementaryInputBackend.h"
 #include <QDir>
+#include <QFile>
 #include <QLoggingCategory>
 #include <QObject>
 #include <fcntl.h>
@@ -28,17 +29,29 @@ namespace libinputactions
 
 Q_LOGGING_CATEGORY(INPUTACTIONS_BACKEND_LIBEVDEV, "inputactions.input.backend.libevdev", QtWarningMsg)
 
-LibevdevComplementaryInputBackend::LibevdevComplementaryInputBackend()
+static constexpr uint8_t MAX_SLOTS = 64;
+
+static constexpr uint8_t fingerCount(uint16_t code)
 {
-    m_inputTimer.setTimerType(Qt::TimerType::PreciseTimer);
-    m_inputTimer.setInterval(100);
-    QObject::connect(&m_inputTimer, &QTimer::timeout, [this] {
-        poll();
-    });
+    switch (code) {
+        case BTN_TOOL_FINGER:
+            return 1;
+        case BTN_TOOL_DOUBLETAP:
+            return 2;
+        case BTN_TOOL_TRIPLETAP:
+            return 3;
+        case BTN_TOOL_QUADTAP:
+            return 4;
+        case BTN_TOOL_QUINTTAP:
+            return 5;
+        default:
+            return 0;
+    }
 }
 
 LibevdevDevice::~LibevdevDevice()
 {
+    notifier.reset();
     if (libevdevPtr) {
         libevdev_free(libevdevPtr);
     }
@@ -62,11 +75,51 @@ std::unique_ptr<LibevdevDevice> LibevdevComplementaryInputBackend::openDevice(co
         device->libevdevPtr = nullptr;
         return {};
     }
+    // Event timestamps use CLOCK_REALTIME by default
+    libevdev_set_clock_id(device->libevdevPtr, CLOCK_MONOTONIC);
     device->name = QString::fromStdString(libevdev_get_name(device->libevdevPtr));
     return device;
     qCDebug(INPUTACTIONS_BACKEND_LIBEVDEV).noquote().nospace() << "Opened device (name: " << libevdev_get_name(device->libevdevPtr) << ")";
 }
 
+std::unique_ptr<LibevdevDevice> LibevdevComplementaryInputBackend::openDeviceByName(const QString &name)
+{
+    const auto open = [this, &name]() -> std::unique_ptr<LibevdevDevice> {
+        const auto [begin, end] = m_eventNodes.equal_range(name);
+        for (auto it = begin; it != end; it++) {
+            // The node may have been reused by a different device
+            if (auto device = openDevice(it->second); device && device->name == name) {
+                return device;
+            }
+        }
+        return {};
+    };
+
+    if (auto device = open()) {
+        return device;
+    }
+    updateEventNodes();
+    return open();
+}
+
+void LibevdevComplementaryInputBackend::updateEventNodes()
+{
+    m_eventNodes.clear();
+    for (const auto &node : QDir("/sys/class/input").entryList({"event*"}, QDir::Dirs | QDir::Files | QDir::System)) {
+        QFile file(QString("/sys/class/input/%1/device/name").arg(node));
+        if (!file.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        auto name = QString::fromUtf8(file.readAll());
+        // Only the newline is added by sysfs, other whitespace is a part of the name
+        if (name.endsWith('\n')) {
+            name.chop(1);
+        }
+        m_eventNodes.emplace(name, node);
+    }
+    qCDebug(INPUTACTIONS_BACKEND_LIBEVDEV).noquote() << QString("Indexed %1 event nodes").arg(m_eventNodes.size());
+}
+
 void LibevdevComplementaryInputBackend::deviceAdded(InputDevice *device)
 {
     InputBackend::deviceAdded(device);
@@ -82,18 +135,8 @@ void LibevdevComplementaryInputBackend::deviceAdded(InputDevice *device)
     if (!device->sysName().isEmpty()) {
         libevdevDevice = openDevice(device->sysName());
     } else {
-        // If sysName is not available, go through all devices and find one with the same name
-        for (const auto &entry : QDir("/dev/input").entryInfoList(QDir::Files | QDir::NoSymLinks | QDir::System)) {
-            libevdevDevice = openDevice(entry.fileName());
-            if (!libevdevDevice) {
-                continue;
-            }
-
-            if (libevdevDevice->name == device->name()) {
-                break;
-            }
-            libevdevDevice.reset();
-        }
+        // If sysName is not available, find a device with the same name
+        libevdevDevice = openDeviceByName(device->name());
     }
     if (!libevdevDevice) {
         return;
@@ -115,7 +158,7 @@ void LibevdevComplementaryInputBackend::deviceAdded(InputDevice *device)
     uint8_t slotCount = 1;
     if (libevdev_has_event_code(libevdevDevice->libevdevPtr, EV_ABS, ABS_MT_SLOT)) {
         multiTouch = true;
-        slotCount = libevdev_get_abs_maximum(libevdevDevice->libevdevPtr, ABS_MT_SLOT) + 1;
+        slotCount = std::min(libevdev_get_abs_maximum(libevdevDevice->libevdevPtr, ABS_MT_SLOT) + 1, static_cast<int>(MAX_SLOTS));
     }
     qCDebug(INPUTACTIONS_BACKEND_LIBEVDEV).noquote().nospace()
         << "Found valid touchpad (size: " << size << ", multiTouch: " << multiTouch << ", slots: " << slotCount << ")";
@@ -126,8 +169,11 @@ void LibevdevComplementaryInputBackend::deviceAdded(InputDevice *device)
     properties.setButtonPad(buttonPad);
 
     libevdevDevice->fingerSlots = std::vector<TouchpadSlot>{slotCount};
+    libevdevDevice->notifier = std::make_unique<QSocketNotifier>(libevdevDevice->fd, QSocketNotifier::Read);
+    QObject::connect(libevdevDevice->notifier.get(), &QSocketNotifier::activated, [this, device, libevdevDevice = libevdevDevice.get()] {
+        poll(device, libevdevDevice);
+    });
     m_libevdevDevices[device] = std::move(libevdevDevice);
-    m_inputTimer.start();
 }
 
 void LibevdevComplementaryInputBackend::deviceRemoved(const InputDevice *device)
@@ -135,122 +181,138 @@ void LibevdevComplementaryInputBackend::deviceRemoved(const InputDevice *device)
     InputBackend::deviceRemoved(device);
     for (auto it = m_libevdevDevices.begin(); it != m_libevdevDevices.end(); it++) {
         if (it->first == device) {
+            // Handlers may keep a reference to the slots. Sent directly, as the event must not be dropped.
+            const TouchpadSlotEvent slotEvent(it->first, {}, 0);
+            for (const auto &handler : m_handlers) {
+                handler->handleEvent(&slotEvent);
+            }
             m_libevdevDevices.erase(it);
             break;
         }
     }
+}
 
-    if (m_libevdevDevices.empty()) {
-        m_inputTimer.stop();
+void LibevdevComplementaryInputBackend::poll()
+{
+    for (auto &[device, libevdevDevice] : m_libevdevDevices) {
+        poll(device, libevdevDevice.get());
     }
 }
 
-void LibevdevComplementaryInputBackend::poll()
+void LibevdevComplementaryInputBackend::poll(InputDevice *device, LibevdevDevice *libevdevDevice)
 {
     if (m_ignoreEvents) {
         return;
     }
 
     input_event event;
-    for (auto &[device, libevdevDevice] : m_libevdevDevices) {
-        const auto &properties = device->properties();
-        int status{};
-        while (true) {
-            auto flags = status == LIBEVDEV_READ_STATUS_SYNC ? LIBEVDEV_READ_FLAG_SYNC : LIBEVDEV_READ_FLAG_NORMAL;
-            status = libevdev_next_event(libevdevDevice->libevdevPtr, flags, &event);
-            if (status != LIBEVDEV_READ_STATUS_SUCCESS && status != LIBEVDEV_READ_STATUS_SYNC) {
-                break;
-            }
+    const auto &properties = device->properties();
+    int status{};
+    while (true) {
+        auto flags = status == LIBEVDEV_READ_STATUS_SYNC ? LIBEVDEV_READ_FLAG_SYNC : LIBEVDEV_READ_FLAG_NORMAL;
+        status = libevdev_next_event(libevdevDevice->libevdevPtr, flags, &event);
+        if (status == -ENODEV) {
+            // The device is gone, stop the notifier from firing until the device is removed
+            qCDebug(INPUTACTIONS_BACKEND_LIBEVDEV).noquote() << QString("Device disappeared (name: %1)").arg(libevdevDevice->name);
+            libevdevDevice->notifier->setEnabled(false);
+            return;
+        }
+        if (status != LIBEVDEV_READ_STATUS_SUCCESS && status != LIBEVDEV_READ_STATUS_SYNC) {
+            break;
+        }
 
-            const auto code = event.code;
-            const auto value = event.value;
-            switch (event.type) {
-                case EV_SYN:
-                    if (code == SYN_REPORT) {
-                        const TouchpadSlotEvent slotEvent(device, libevdevDevice->fingerSlots);
-                        handleEvent(&slotEvent);
+        const auto code = event.code;
+        const auto value = event.value;
+        const auto timestamp = std::chrono::seconds(event.input_event_sec) + std::chrono::microseconds(event.input_event_usec);
+        switch (event.type) {
+            case EV_SYN:
+                if (code == SYN_REPORT) {
+                    const auto slotsChanged = libevdevDevice->changedSlots != 0;
+                    if (slotsChanged) {
+                        TouchpadSlotEvent slotEvent(device, libevdevDevice->fingerSlots, libevdevDevice->changedSlots);
+                        libevdevDevice->changedSlots = 0;
+                        handleEvent(&slotEvent, timestamp);
+                    }
 
-                        static const std::map<uint16_t, uint8_t> fingerCountCodes = {
-                            {0, 0},
-                            {BTN_TOOL_FINGER, 1},
-                            {BTN_TOOL_DOUBLETAP, 2},
-                            {BTN_TOOL_TRIPLETAP, 3},
-                            {BTN_TOOL_QUADTAP, 4},
-                            {BTN_TOOL_QUINTTAP, 5},
-                        };
-                        g_variableManager->getVariable(BuiltinVariables::Fingers)->set(fingerCountCodes.at(libevdevDevice->currentFingerCode));
+                    // The variable may have been overwritten by something else, set it again with every report that changes the touchpad's state. Setting
+                    // it to the same value does nothing.
+                    if (slotsChanged || libevdevDevice->reportedFingerCode != libevdevDevice->currentFingerCode) {
+                        libevdevDevice->reportedFingerCode = libevdevDevice->currentFingerCode;
+                        g_variableManager->getVariable(BuiltinVariables::Fingers)->set(fingerCount(libevdevDevice->currentFingerCode));
                     }
-                    continue;
-                case EV_KEY:
+                }
+                continue;
+            case EV_KEY:
+                switch (code) {
+                    case BTN_TOOL_FINGER:
+                    case BTN_TOOL_DOUBLETAP:
+                    case BTN_TOOL_TRIPLETAP:
+                    case BTN_TOOL_QUADTAP:
+                    case BTN_TOOL_QUINTTAP:
+                        if (value == 1) {
+                            libevdevDevice->currentFingerCode = code;
+                        } else if (value == 0 && libevdevDevice->currentFingerCode == code) {
+                            libevdevDevice->currentFingerCode = 0;
+                        }
+                        continue;
+                    case BTN_LEFT:
+                    case BTN_MIDDLE:
+                    case BTN_RIGHT:
+                        if (properties.buttonPad()) {
+                            TouchpadClickEvent clickEvent(device, value);
+                            handleEvent(&clickEvent, timestamp);
+                        }
+                        continue;
+                }
+                continue;
+            case EV_ABS:
+                auto &currentSlot = libevdevDevice->fingerSlots[libevdevDevice->currentSlot];
+                if (properties.multiTouch()) {
                     switch (code) {
-                        case BTN_TOOL_FINGER:
-                        case BTN_TOOL_DOUBLETAP:
-                        case BTN_TOOL_TRIPLETAP:
-                        case BTN_TOOL_QUADTAP:
-                        case BTN_TOOL_QUINTTAP:
-                            if (value == 1) {
-                                libevdevDevice->currentFingerCode = code;
-                            } else if (value == 0 && libevdevDevice->currentFingerCode == code) {
-                                libevdevDevice->currentFingerCode = 0;
+                        case ABS_MT_SLOT:
+                            if (value >= 0 && static_cast<size_t>(value) < libevdevDevice->fingerSlots.size()) {
+                                libevdevDevice->currentSlot = value;
                             }
                             continue;
-                        case BTN_LEFT:
-                        case BTN_MIDDLE:
-                        case BTN_RIGHT:
-                            if (properties.buttonPad()) {
-                                const TouchpadClickEvent clickEvent(device, value);
-                                handleEvent(&clickEvent);
-                            }
+                        case ABS_MT_TRACKING_ID:
+                            libevdevDevice->setSlotValue(currentSlot.active, value != -1);
+                            continue;
+                        case ABS_MT_POSITION_X:
+                            libevdevDevice->setSlotValue(currentSlot.position.rx(), value / properties.size().width());
+                            continue;
+                        case ABS_MT_POSITION_Y:
+                            libevdevDevice->setSlotValue(currentSlot.position.ry(), value / properties.size().height());
+                            continue;
+                        case ABS_MT_PRESSURE:
+                            libevdevDevice->setSlotValue(currentSlot.pressure, value);
                             continue;
                     }
-                    continue;
-                case EV_ABS:
-                    auto &currentSlot = libevdevDevice->fingerSlots[libevdevDevice->currentSlot];
-                    if (properties.multiTouch()) {
-                        switch (code) {
-                            case ABS_MT_SLOT:
-                                libevdevDevice->currentSlot = value;
-                                continue;
-                            case ABS_MT_TRACKING_ID:
-                                currentSlot.active = value != -1;
-                                continue;
-                            case ABS_MT_POSITION_X:
-                                currentSlot.position.setX(value / properties.size().width());
-                                continue;
-                            case ABS_MT_POSITION_Y:
-                                currentSlot.position.setY(value / properties.size().height());
-                                continue;
-                            case ABS_MT_PRESSURE:
-                                currentSlot.pressure = value;
-                                continue;
-                        }
-                    } else {
-                        switch (code) {
-                            case ABS_X:
-                                currentSlot.position.setX(value / properties.size().width());
-                                continue;
-                            case ABS_Y:
-                                currentSlot.position.setY(value / properties.size().height());
-                                continue;
-                            case ABS_PRESSURE:
-                                currentSlot.pressure = value;
-                                continue;
-                        }
+                } else {
+                    switch (code) {
+                        case ABS_X:
+                            libevdevDevice->setSlotValue(currentSlot.position.rx(), value / properties.size().width());
+                            continue;
+                        case ABS_Y:
+                            libevdevDevice->setSlotValue(currentSlot.position.ry(), value / properties.size().height());
+                            continue;
+                        case ABS_PRESSURE:
+                            libevdevDevice->setSlotValue(currentSlot.pressure, value);
+                            continue;
                     }
-                    continue;
-            }
+                }
+                continue;
         }
     }
 }
 
-void LibevdevComplementaryInputBackend::setPollingInterval(uint32_t value)
-{
-    m_inputTimer.setInterval(value);
-}
-
 void LibevdevComplementaryInputBackend::setEnabled(bool value)
 {
+    if (m_enabled == value) {
+        return;
+    }
+
     m_enabled = value;
+    redetectDevices();
 }
 
 }
@@ -18,11 +18,12 @@
 
 #pragma once
 
-#include <QTimer>
+#include <QSocketNotifier>
 #include <libevdev-1.0/libevdev/libevdev.h>
 #include <libinputactions/input/backends/InputBackend.h>
 #include <libinputactions/input/events.h>
 #include <map>
+#include <type_traits>
 
 namespace libinputactions
 {
@@ -34,37 +35,58 @@ struct LibevdevDevice
     libevdev *libevdevPtr = nullptr;
     int fd = -1;
     QString name;
+    /**
+     * Notifies when events are available to be read from fd.
+     */
+    std::unique_ptr<QSocketNotifier> notifier;
 
     /**
-     * If device doesn't support MT type B protocol, only the first slot will be used.
+     * If device doesn't support MT type B protocol, only the first slot will be used. Limited to 64 slots.
      */
     std::vector<TouchpadSlot> fingerSlots;
     uint8_t currentSlot{};
+    /**
+     * Bitmask of slots that have changed since the last SYN_REPORT.
+     */
+    uint64_t changedSlots{};
     /**
      * 0, BTN_TOOL_FINGER, BTN_TOOL_DOUBLETAP, BTN_TOOL_TRIPLETAP, BTN_TOOL_QUADTAP or BTN_TOOL_QUINTTAP
      */
     uint16_t currentFingerCode{};
+    /**
+     * The finger code at the last SYN_REPORT.
+     */
+    uint16_t reportedFingerCode{};
+
+    /**
+     * Sets a field of the current slot and marks the slot as changed if the value is different.
+     */
+    template<typename T>
+    void setSlotValue(T &field, const std::type_identity_t<T> &value)
+    {
+        if (field == value) {
+            return;
+        }
+        field = value;
+        changedSlots |= 1ull << currentSlot;
+    }
 };
 
 /**
- * Uses libevdev to get additional touchpad data that libinput does not provide.
+ * Uses libevdev to get additional touchpad data that libinput does not provide. Events are read as soon as they are
+ * available.
  *
  * Emitted events: TouchpadClick, TouchpadSlot
  */
 class LibevdevComplementaryInputBackend : public virtual InputBackend
 {
 public:
-    LibevdevComplementaryInputBackend();
+    LibevdevComplementaryInputBackend() = default;
 
     void poll() override;
 
     /**
-     * @param value How often to poll input events.
-     */
-    void setPollingInterval(uint32_t value);
-
-    /**
-     * Will take effect only if set before initialization.
+     * Changing the value closes or opens the devices of all touchpads that have already been added.
      */
     void setEnabled(bool value);
 
@@ -74,9 +96,25 @@ protected:
 
 private:
     std::unique_ptr<LibevdevDevice> openDevice(const QString &sysName);
+    /**
+     * Opens the event node of the device with the specified name using the sysfs index. The index is rebuilt if it does
+     * not contain a matching node, as it may be outdated after hotplug.
+     */
+    std::unique_ptr<LibevdevDevice> openDeviceByName(const QString &name);
+    /**
+     * Rebuilds m_eventNodes from /sys/class/input.
+     */
+    void updateEventNodes();
+    /**
+     * Handles all events that are available for the specified device.
+     */
+    void poll(InputDevice *device, LibevdevDevice *libevdevDevice);
 
     bool m_enabled = true;
     std::map<InputDevice *, std::unique_ptr<LibevdevDevice>> m_libevdevDevices;
-    QTimer m_inputTimer;
+    /**
+     * Device name -> event node (e.g. event5). Multiple nodes can have the same name.
+     */
+    std::multimap<QString, QString> m_eventNodes;
 };
 }
\ No newline at end of file
@@ -24,26 +24,35 @@ namespace libinputactions
 
 static const uint32_t STROKE_RECORD_TIMEOUT = 250;
 
-bool LibinputCompositorInputBackend::keyboardKey(InputDevice *sender, uint32_t key, bool state)
+bool LibinputCompositorInputBackend::keyboardKey(InputDevice *sender, uint32_t key, bool state, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
     }
 
-    const KeyboardKeyEvent keyEvent(sender, key, state);
-    handleEvent(&keyEvent);
+    KeyboardKeyEvent keyEvent(sender, key, state);
+    handleEvent(&keyEvent, timestamp);
     return false;
 }
 
-bool LibinputCompositorInputBackend::pointerAxis(InputDevice *sender, const QPointF &delta)
+bool LibinputCompositorInputBackend::pointerAxis(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
     }
 
     if (sender->type() == InputDeviceType::Mouse) {
-        const MotionEvent wheelEvent(sender, InputEventType::PointerScroll, delta);
-        return handleEvent(&wheelEvent);
+        MotionEvent wheelEvent(sender, InputEventType::PointerScroll, delta);
+        return handleEvent(&wheelEvent, timestamp);
+    }
+
+    // Scrolling ends with a (0,0) event
+    if (delta.isNull()) {
+        m_scrollInProgress = false;
+    } else if (!m_scrollInProgress) {
+        // The compositor may read libinput before the device becomes readable here, update the finger count at the start of the sequence
+        LibevdevComplementaryInputBackend::poll();
+        m_scrollInProgress = true;
     }
 
     if (m_isRecordingStroke) {
@@ -55,12 +64,15 @@ bool LibinputCompositorInputBackend::pointerAxis(InputDevice *sender, const QPoi
         return true;
     }
 
-    LibevdevComplementaryInputBackend::poll(); // Update finger count
-    const MotionEvent scrollEvent(sender, InputEventType::PointerScroll, delta);
-    return handleEvent(&scrollEvent);
+    MotionEvent scrollEvent(sender, InputEventType::PointerScroll, delta);
+    return handleEvent(&scrollEvent, timestamp);
 }
 
-bool LibinputCompositorInputBackend::pointerButton(InputDevice *sender, Qt::MouseButton button, uint32_t nativeButton, bool state)
+bool LibinputCompositorInputBackend::pointerButton(InputDevice *sender,
+                                                   Qt::MouseButton button,
+                                                   uint32_t nativeButton,
+                                                   bool state,
+                                                   std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -69,11 +81,11 @@ bool LibinputCompositorInputBackend::pointerButton(InputDevice *sender, Qt::Mous
     if (sender->type() == InputDeviceType::Touchpad) {
         LibevdevComplementaryInputBackend::poll(); // Update clicked state
     }
-    const PointerButtonEvent buttonEvent(sender, button, nativeButton, state);
-    return handleEvent(&buttonEvent);
+    PointerButtonEvent buttonEvent(sender, button, nativeButton, state);
+    return handleEvent(&buttonEvent, timestamp);
 }
 
-bool LibinputCompositorInputBackend::pointerMotion(InputDevice *sender, const QPointF &delta)
+bool LibinputCompositorInputBackend::pointerMotion(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender || sender->type() != InputDeviceType::Mouse) {
         return false;
@@ -83,13 +95,13 @@ bool LibinputCompositorInputBackend::pointerMotion(InputDevice *sender, const QP
         m_strokePoints.push_back(delta);
         m_strokeRecordingTimeoutTimer.start(STROKE_RECORD_TIMEOUT);
     } else {
-        const MotionEvent motionEvent(sender, InputEventType::PointerMotion, delta);
-        handleEvent(&motionEvent);
+        MotionEvent motionEvent(sender, InputEventType::PointerMotion, delta);
+        handleEvent(&motionEvent, timestamp);
     }
     return false;
 }
 
-bool LibinputCompositorInputBackend::touchpadHoldBegin(InputDevice *sender, uint8_t fingers)
+bool LibinputCompositorInputBackend::touchpadHoldBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -97,26 +109,26 @@ bool LibinputCompositorInputBackend::touchpadHoldBegin(InputDevice *sender, uint
 
     m_fingers = fingers;
     LibevdevComplementaryInputBackend::poll(); // Update clicked state
-    const TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::Press, fingers);
-    m_block = handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::Press, fingers);
+    m_block = handleEvent(&event, timestamp);
     return m_block;
 }
 
-bool LibinputCompositorInputBackend::touchpadHoldEnd(InputDevice *sender, bool cancelled)
+bool LibinputCompositorInputBackend::touchpadHoldEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
     }
 
     LibevdevComplementaryInputBackend::poll(); // Update clicked state
-    const TouchpadGestureLifecyclePhaseEvent event(sender,
-                                                   cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
-                                                   TriggerType::Press);
-    handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender,
+                                             cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
+                                             TriggerType::Press);
+    handleEvent(&event, timestamp);
     return m_block;
 }
 
-bool LibinputCompositorInputBackend::touchpadPinchBegin(InputDevice *sender, uint8_t fingers)
+bool LibinputCompositorInputBackend::touchpadPinchBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -124,19 +136,19 @@ bool LibinputCompositorInputBackend::touchpadPinchBegin(InputDevice *sender, uin
 
     m_fingers = fingers;
     LibevdevComplementaryInputBackend::poll(); // Update finger count
-    const TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::PinchRotate, fingers);
-    m_block = handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::PinchRotate, fingers);
+    m_block = handleEvent(&event, timestamp);
     return m_block;
 }
 
-bool LibinputCompositorInputBackend::touchpadPinchUpdate(InputDevice *sender, qreal scale, qreal angleDelta)
+bool LibinputCompositorInputBackend::touchpadPinchUpdate(InputDevice *sender, qreal scale, qreal angleDelta, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
     }
 
-    const TouchpadPinchEvent event(sender, scale, angleDelta);
-    const auto block = handleEvent(&event);
+    TouchpadPinchEvent event(sender, scale, angleDelta);
+    const auto block = handleEvent(&event, timestamp);
     if (m_block && !block) {
         // Allow the compositor/client to handle the gesture
         g_inputEmitter->touchpadPinchBegin(m_fingers);
@@ -145,19 +157,19 @@ bool LibinputCompositorInputBackend::touchpadPinchUpdate(InputDevice *sender, qr
     return block;
 }
 
-bool LibinputCompositorInputBackend::touchpadPinchEnd(InputDevice *sender, bool cancelled)
+bool LibinputCompositorInputBackend::touchpadPinchEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
     }
 
-    const TouchpadGestureLifecyclePhaseEvent event(sender,
-                                                   cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
-                                                   TriggerType::PinchRotate);
-    return handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender,
+                                             cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
+                                             TriggerType::PinchRotate);
+    return handleEvent(&event, timestamp);
 }
 
-bool LibinputCompositorInputBackend::touchpadSwipeBegin(InputDevice *sender, uint8_t fingers)
+bool LibinputCompositorInputBackend::touchpadSwipeBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -167,12 +179,12 @@ bool LibinputCompositorInputBackend::touchpadSwipeBegin(InputDevice *sender, uin
 
     m_fingers = fingers;
     LibevdevComplementaryInputBackend::poll(); // Update finger count
-    const TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::StrokeSwipe, fingers);
-    m_block = handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender, TouchpadGestureLifecyclePhase::Begin, TriggerType::StrokeSwipe, fingers);
+    m_block = handleEvent(&event, timestamp);
     return m_block;
 }
 
-bool LibinputCompositorInputBackend::touchpadSwipeUpdate(InputDevice *sender, const QPointF &delta)
+bool LibinputCompositorInputBackend::touchpadSwipeUpdate(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -183,8 +195,8 @@ bool LibinputCompositorInputBackend::touchpadSwipeUpdate(InputDevice *sender, co
         return true;
     }
 
-    const MotionEvent event(sender, InputEventType::TouchpadSwipe, delta);
-    const auto block = handleEvent(&event);
+    MotionEvent event(sender, InputEventType::TouchpadSwipe, delta);
+    const auto block = handleEvent(&event, timestamp);
     if (m_block && !block) {
         // Allow the compositor/client to handle the gesture
         g_inputEmitter->touchpadSwipeBegin(m_fingers);
@@ -193,7 +205,7 @@ bool LibinputCompositorInputBackend::touchpadSwipeUpdate(InputDevice *sender, co
     return block;
 }
 
-bool LibinputCompositorInputBackend::touchpadSwipeEnd(InputDevice *sender, bool cancelled)
+bool LibinputCompositorInputBackend::touchpadSwipeEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp)
 {
     if (m_ignoreEvents || !sender) {
         return false;
@@ -204,10 +216,10 @@ bool LibinputCompositorInputBackend::touchpadSwipeEnd(InputDevice *sender, bool
         return true;
     }
 
-    const TouchpadGestureLifecyclePhaseEvent event(sender,
-                                                   cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
-                                                   TriggerType::StrokeSwipe);
-    return handleEvent(&event);
+    TouchpadGestureLifecyclePhaseEvent event(sender,
+                                             cancelled ? TouchpadGestureLifecyclePhase::Cancel : TouchpadGestureLifecyclePhase::End,
+                                             TriggerType::StrokeSwipe);
+    return handleEvent(&event, timestamp);
 }
 
 Qt::MouseButton LibinputCompositorInputBackend::scanCodeToMouseButton(uint32_t scanCode) const
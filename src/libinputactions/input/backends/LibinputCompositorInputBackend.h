@@ -24,6 +24,9 @@ namespace libinputactions
 
 /**
  * Input backend for compositors that use libinput. Uses libevdev backend.
+ *
+ * All methods accept an optional monotonic timestamp of the event provided by the compositor. If not specified, the time at which the event was created
+ * is used.
  */
 class LibinputCompositorInputBackend : public LibevdevComplementaryInputBackend
 {
@@ -34,78 +37,79 @@ protected:
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool keyboardKey(InputDevice *sender, uint32_t key, bool state);
+    bool keyboardKey(InputDevice *sender, uint32_t key, bool state, std::chrono::microseconds timestamp = {});
 
     /**
      * Handles mouse wheel and touchpad scroll.
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool pointerAxis(InputDevice *sender, const QPointF &delta);
+    bool pointerAxis(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp = {});
     /**
      * Handles mouse and touchpad buttons.
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool pointerButton(InputDevice *sender, Qt::MouseButton button, uint32_t nativeButton, bool state);
+    bool pointerButton(InputDevice *sender, Qt::MouseButton button, uint32_t nativeButton, bool state, std::chrono::microseconds timestamp = {});
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool pointerMotion(InputDevice *sender, const QPointF &delta);
+    bool pointerMotion(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp = {});
 
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadHoldBegin(InputDevice *sender, uint8_t fingers);
+    bool touchpadHoldBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp = {});
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadHoldEnd(InputDevice *sender, bool cancelled);
+    bool touchpadHoldEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp = {});
 
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadPinchBegin(InputDevice *sender, uint8_t fingers);
+    bool touchpadPinchBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp = {});
     /**
      * If the previous event (begin or update) was blocked but this one will not be, a pinch begin event will be emitted to allow the compositor/client to
      * handle the gesture.
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadPinchUpdate(InputDevice *sender, qreal scale, qreal angleDelta);
+    bool touchpadPinchUpdate(InputDevice *sender, qreal scale, qreal angleDelta, std::chrono::microseconds timestamp = {});
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadPinchEnd(InputDevice *sender, bool cancelled);
+    bool touchpadPinchEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp = {});
 
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadSwipeBegin(InputDevice *sender, uint8_t fingers);
+    bool touchpadSwipeBegin(InputDevice *sender, uint8_t fingers, std::chrono::microseconds timestamp = {});
     /**
      * If the previous event (begin or update) was blocked but this one will not be, a swipe begin event will be emitted to allow the compositor/client to
      * handle the gesture.
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadSwipeUpdate(InputDevice *sender, const QPointF &delta);
+    bool touchpadSwipeUpdate(InputDevice *sender, const QPointF &delta, std::chrono::microseconds timestamp = {});
     /**
      * @param sender The event will be ignored if nullptr.
      * @returns Whether to block the event.
      */
-    bool touchpadSwipeEnd(InputDevice *sender, bool cancelled);
+    bool touchpadSwipeEnd(InputDevice *sender, bool cancelled, std::chrono::microseconds timestamp = {});
 
     Qt::MouseButton scanCodeToMouseButton(uint32_t scanCode) const;
 
 private:
     uint32_t m_fingers{};
     bool m_block{};
+    bool m_scrollInProgress{};
 };
 
 }
\ No newline at end of file
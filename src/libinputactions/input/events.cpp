@@ -24,6 +24,7 @@ namespace libinputactions
 InputEvent::InputEvent(InputEventType type, InputDevice *sender)
     : m_type(type)
     , m_sender(sender)
+    , m_timestamp(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()))
 {
 }
 
@@ -37,6 +38,16 @@ const InputDevice *InputEvent::sender() const
     return m_sender;
 }
 
+const std::chrono::microseconds &InputEvent::timestamp() const
+{
+    return m_timestamp;
+}
+
+void InputEvent::setTimestamp(const std::chrono::microseconds &value)
+{
+    m_timestamp = value;
+}
+
 MotionEvent::MotionEvent(InputDevice *sender, InputEventType type, const QPointF &delta)
     : InputEvent(type, sender)
     , m_delta(delta)
@@ -140,15 +151,21 @@ const uint8_t &TouchpadGestureLifecyclePhaseEvent::fingers() const
     return m_fingers;
 }
 
-TouchpadSlotEvent::TouchpadSlotEvent(InputDevice *sender, const std::vector<TouchpadSlot> &fingerSlots)
+TouchpadSlotEvent::TouchpadSlotEvent(InputDevice *sender, std::span<const TouchpadSlot> fingerSlots, uint64_t changedSlots)
     : InputEvent(InputEventType::TouchpadSlot, sender)
     , m_slots(fingerSlots)
+    , m_changedSlots(changedSlots)
 {
 }
 
-const std::vector<TouchpadSlot> &TouchpadSlotEvent::fingerSlots() const
+std::span<const TouchpadSlot> TouchpadSlotEvent::fingerSlots() const
 {
     return m_slots;
 }
 
+const uint64_t &TouchpadSlotEvent::changedSlots() const
+{
+    return m_changedSlots;
+}
+
 }
\ No newline at end of file
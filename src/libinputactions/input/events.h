@@ -21,7 +21,9 @@
 #include "InputDevice.h"
 #include <QKeyCombination>
 #include <QPointF>
+#include <chrono>
 #include <libinputactions/globals.h>
+#include <span>
 
 namespace libinputactions
 {
@@ -56,12 +58,20 @@ public:
     const InputEventType &type() const;
     const InputDevice *sender() const;
 
+    /**
+     * Time at which the event was generated on the CLOCK_MONOTONIC clock. Set by backends to the hardware timestamp if available, otherwise the time at
+     * which the event was created.
+     */
+    const std::chrono::microseconds &timestamp() const;
+    void setTimestamp(const std::chrono::microseconds &value);
+
 protected:
     InputEvent(InputEventType type, InputDevice *sender);
 
 private:
     InputEventType m_type;
     InputDevice *m_sender;
+    std::chrono::microseconds m_timestamp;
 };
 
 class MotionEvent : public InputEvent
@@ -149,15 +159,27 @@ struct TouchpadSlot
     uint32_t pressure{};
 };
 
+/**
+ * Emitted only when at least one slot has changed. The slots are owned by the backend and are only valid for the lifetime
+ * of the event.
+ */
 class TouchpadSlotEvent : public InputEvent
 {
 public:
-    TouchpadSlotEvent(InputDevice *sender, const std::vector<TouchpadSlot> &fingerSlots);
+    /**
+     * @param changedSlots Bitmask of slots that have changed since the previous event.
+     */
+    TouchpadSlotEvent(InputDevice *sender, std::span<const TouchpadSlot> fingerSlots, uint64_t changedSlots);
 
-    const std::vector<TouchpadSlot> &fingerSlots() const;
+    std::span<const TouchpadSlot> fingerSlots() const;
+    /**
+     * Bitmask of slots that have changed since the previous event. Bit N corresponds to slot N.
+     */
+    const uint64_t &changedSlots() const;
 
 private:
-    std::vector<TouchpadSlot> m_slots;
+    std::span<const TouchpadSlot> m_slots;
+    uint64_t m_changedSlots;
 };
 
 }
\ No newline at end of file
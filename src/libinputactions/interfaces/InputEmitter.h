@@ -30,6 +30,16 @@ public:
     InputEmitter() = default;
     virtual ~InputEmitter() = default;
 
+    /**
+     * Groups all events emitted until commit is called, so that implementations can emit them more efficiently. Batches
+     * can be nested, only the outermost one has an effect.
+     */
+    void beginBatch();
+    /**
+     * Ends the batch started by beginBatch.
+     */
+    void commit();
+
     virtual void keyboardClearModifiers() {};
     /**
      * @param key <linux/input-event-codes.h>
@@ -47,6 +57,19 @@ public:
 
     virtual void touchpadPinchBegin(uint8_t fingers) {};
     virtual void touchpadSwipeBegin(uint8_t fingers) {};
+
+protected:
+    /**
+     * Called when the outermost batch begins.
+     */
+    virtual void batchBegun() {};
+    /**
+     * Called when the outermost batch is committed.
+     */
+    virtual void batchCommitted() {};
+
+private:
+    uint32_t m_batchDepth{};
 };
 
 inline std::shared_ptr<InputEmitter> g_inputEmitter;
@@ -34,12 +34,12 @@ void Trigger::addAction(std::unique_ptr<TriggerAction> action)
 
 void Trigger::setActivationCondition(const std::shared_ptr<const Condition> &condition)
 {
-    m_activationCondition = condition;
+    m_activationCondition = ConditionProgram(condition);
 }
 
 void Trigger::setEndCondition(const std::shared_ptr<const Condition> &condition)
 {
-    m_endCondition = condition;
+    m_endCondition = ConditionProgram(condition);
 }
 
 bool Trigger::canActivate(const TriggerActivationEvent *event) const
@@ -54,7 +54,14 @@ bool Trigger::canActivate(const TriggerActivationEvent *event) const
         }
     }
 
-    return !m_activationCondition || m_activationCondition.value()->satisfied();
+    return !m_activationCondition || m_activationCondition->evaluate();
+}
+
+void Trigger::prefetchValues()
+{
+    for (const auto &action : m_actions) {
+        action->prefetchValues();
+    }
 }
 
 bool Trigger::canUpdate(const TriggerUpdateEvent *) const
@@ -99,7 +106,7 @@ void Trigger::update(const TriggerUpdateEvent *event)
 
 bool Trigger::canEnd() const
 {
-    return m_withinThreshold && (!m_endCondition || m_endCondition.value()->satisfied());
+    return m_withinThreshold && (!m_endCondition || m_endCondition->evaluate());
 }
 
 void Trigger::end()
@@ -22,6 +22,7 @@
 #include <QString>
 #include <libinputactions/actions/TriggerAction.h>
 #include <libinputactions/conditions/Condition.h>
+#include <libinputactions/conditions/ConditionProgram.h>
 #include <libinputactions/globals.h>
 
 Q_DECLARE_LOGGING_CATEGORY(INPUTACTIONS_TRIGGER)
@@ -77,6 +78,12 @@ public:
      */
     TEST_VIRTUAL bool canActivate(const TriggerActivationEvent *event) const;
 
+    /**
+     * Called by the trigger handler when the trigger is activated.
+     * @internal
+     */
+    void prefetchValues();
+
     /**
      * Called by the trigger handler before updating a trigger. If true is returned, that trigger will be cancelled.
      * @internal
@@ -181,8 +188,8 @@ private:
     std::optional<bool> m_clearModifiers;
     bool m_setLastTrigger = true;
 
-    std::optional<std::shared_ptr<const Condition>> m_activationCondition;
-    std::optional<std::shared_ptr<const Condition>> m_endCondition;
+    std::optional<ConditionProgram> m_activationCondition;
+    std::optional<ConditionProgram> m_endCondition;
 
     std::vector<Qt::MouseButton> m_mouseButtons;
     bool m_mouseButtonsExactOrder{};
@@ -33,7 +33,12 @@ std::any LocalVariable::get() const
 
 void LocalVariable::set(std::any value)
 {
+    if (operations() && operations()->equals(m_value, value)) {
+        return;
+    }
+
     m_value = std::move(value);
+    changed();
 }
 
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ namespace libinputactions
 {
 
 /**
- * A locally stored variable with instant access.
+ * A locally stored variable with instant access. Setting the current value again does not count as a change.
  */
 class LocalVariable : public Variable
 {
@@ -0,0 +1,67 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "PointComponentVariable.h"
+#include <QPointF>
+
+namespace libinputactions
+{
+
+PointComponentVariable::PointComponentVariable(const Variable *parent, Qt::Orientation component)
+    : Variable(typeid(qreal))
+    , m_parent(parent)
+    , m_component(component)
+{
+}
+
+std::any PointComponentVariable::get() const
+{
+    const auto value = m_parent->get();
+    if (!value.has_value()) {
+        return {};
+    }
+
+    const auto point = std::any_cast<QPointF>(value);
+    return m_component == Qt::Horizontal ? point.x() : point.y();
+}
+
+const Variable *PointComponentVariable::parent() const
+{
+    return m_parent;
+}
+
+uint32_t PointComponentVariable::cost() const
+{
+    return m_parent->cost();
+}
+
+uint64_t PointComponentVariable::version() const
+{
+    const auto parentVersion = m_parent->version();
+    if (parentVersion != m_parentVersion) {
+        m_parentVersion = parentVersion;
+        auto value = get();
+        if (!operations()->equals(value, m_lastValue)) {
+            m_lastValue = std::move(value);
+            changed();
+        }
+    }
+    return Variable::version();
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+    Input Actions - Input handler that executes user-defined actions
+    Copyright (C) 2024-2025 Marcin Woźniak
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Variable.h"
+
+namespace libinputactions
+{
+
+/**
+ * The x or y component of a point variable. Reads the parent variable directly.
+ */
+class PointComponentVariable : public Variable
+{
+public:
+    /**
+     * @param parent Must be a QPointF variable that outlives this one.
+     */
+    PointComponentVariable(const Variable *parent, Qt::Orientation component);
+
+    std::any get() const override;
+
+    const Variable *parent() const;
+
+    uint32_t cost() const override;
+
+    /**
+     * Changes when the parent variable changes and the component is different.
+     */
+    uint64_t version() const override;
+
+private:
+    const Variable *m_parent;
+    Qt::Orientation m_component;
+
+    mutable uint64_t m_parentVersion{};
+    mutable std::any m_lastValue;
+};
+
+}
\ No newline at end of file
@@ -17,6 +17,7 @@
 */
 
 #include "RemoteVariable.h"
+#include <libinputactions/conditions/Condition.h>
 
 namespace libinputactions
 {
@@ -29,9 +30,33 @@ RemoteVariable::RemoteVariable(std::type_index type, std::function<void(std::any
 
 std::any RemoteVariable::get() const
 {
+    const auto generation = ConditionEvaluationScope::generation();
+    if (generation && generation == m_cachedGeneration) {
+        return m_cachedValue;
+    }
+
     std::any value;
     m_getter(value);
+    if (generation) {
+        m_cachedGeneration = generation;
+        m_cachedValue = value;
+    }
     return value;
 }
 
+uint32_t RemoteVariable::cost() const
+{
+    return 10;
+}
+
+uint64_t RemoteVariable::version() const
+{
+    auto value = get();
+    if (!operations() || !operations()->equals(value, m_lastValue)) {
+        m_lastValue = std::move(value);
+        changed();
+    }
+    return Variable::version();
+}
+
 }
\ No newline at end of file
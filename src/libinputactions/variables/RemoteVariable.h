@@ -25,6 +25,8 @@ namespace libinputactions
 
 /**
  * A variable whose value is calculated or fetched on demand. Variables with slow access are currently not supported.
+ *
+ * While a ConditionEvaluationScope exists, the value is only read once.
  */
 class RemoteVariable : public Variable
 {
@@ -36,8 +38,22 @@ public:
 
     std::any get() const override;
 
+    /**
+     * Remote variables may need to query the compositor, which is more expensive than reading a local variable.
+     */
+    uint32_t cost() const override;
+
+    /**
+     * Remote variables aren't notified about changes. The value is read and compared to the one read previously.
+     */
+    uint64_t version() const override;
+
 private:
     std::function<void(std::any &value)> m_getter;
+    mutable std::any m_lastValue;
+
+    mutable uint64_t m_cachedGeneration{};
+    mutable std::any m_cachedValue;
 };
 
 }
\ No newline at end of file
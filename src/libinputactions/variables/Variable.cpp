@@ -32,6 +32,39 @@ const std::type_index &Variable::type() const
     return m_type;
 }
 
+uint32_t Variable::cost() const
+{
+    return 1;
+}
+
+uint64_t Variable::version() const
+{
+    return m_version;
+}
+
+const bool &Variable::used() const
+{
+    return m_used;
+}
+
+void Variable::setUsed(bool value)
+{
+    m_used = value;
+}
+
+void Variable::setChangedCallback(std::function<void()> callback)
+{
+    m_changedCallback = std::move(callback);
+}
+
+void Variable::changed() const
+{
+    m_version++;
+    if (m_changedCallback) {
+        m_changedCallback();
+    }
+}
+
 const VariableOperationsBase *Variable::operations() const
 {
     return m_operations.get();
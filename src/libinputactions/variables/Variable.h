@@ -21,6 +21,7 @@
 #include "VariableOperations.h"
 #include <QString>
 #include <any>
+#include <functional>
 #include <typeindex>
 
 namespace libinputactions
@@ -51,10 +52,45 @@ public:
 
     const std::type_index &type() const;
 
+    /**
+     * @return Estimated cost of reading the value, relative to other variables.
+     */
+    virtual uint32_t cost() const;
+
+    /**
+     * @return A number that is increased every time the value changes.
+     */
+    virtual uint64_t version() const;
+
+    /**
+     * Whether the variable is referenced by the configuration. Providers may skip updating unused variables.
+     */
+    const bool &used() const;
+    /**
+     * @param value Default: true
+     * @internal Set by VariableManager.
+     */
+    void setUsed(bool value);
+
+    /**
+     * @param callback Called after the value changes.
+     * @internal Used by VariableManager.
+     */
+    void setChangedCallback(std::function<void()> callback);
+
+protected:
+    /**
+     * Must be called by subclasses when the value changes.
+     */
+    void changed() const;
+
 private:
     std::type_index m_type;
     std::variant<bool, QString> m_value;
     std::unique_ptr<VariableOperationsBase> m_operations;
+    mutable uint64_t m_version{};
+    std::function<void()> m_changedCallback;
+    bool m_used = true;
 };
 
 }
\ No newline at end of file
@@ -17,6 +17,7 @@
 */
 
 #include "VariableManager.h"
+#include "PointComponentVariable.h"
 #include "Variable.h"
 #include <QLoggingCategory>
 #include <QRegularExpression>
@@ -126,20 +127,16 @@ VariableManager::VariableManager()
         }
     });
 
+    std::vector<std::pair<QString, const Variable *>> points;
     for (const auto &[name, variable] : m_variables) {
         if (variable->type() == typeid(QPointF)) {
-            registerRemoteVariable<qreal>(name + "_x", [this, name](auto &value) {
-                if (const auto point = getVariable<QPointF>(name)->get()) {
-                    value = point->x();
-                }
-            });
-            registerRemoteVariable<qreal>(name + "_y", [this, name](auto &value) {
-                if (const auto point = getVariable<QPointF>(name)->get()) {
-                    value = point->y();
-                }
-            });
+            points.emplace_back(name, variable.get());
         }
     }
+    for (const auto &[name, variable] : points) {
+        registerVariable(name + "_x", std::make_unique<PointComponentVariable>(variable, Qt::Horizontal));
+        registerVariable(name + "_y", std::make_unique<PointComponentVariable>(variable, Qt::Vertical));
+    }
 }
 
 VariableManager::~VariableManager() = default;
@@ -155,6 +152,11 @@ Variable *VariableManager::getVariable(const QString &name)
 
 void VariableManager::registerVariable(const QString &name, std::unique_ptr<Variable> variable)
 {
+    variable->setChangedCallback([this, name, variable = variable.get()]() {
+        for (const auto &[_, observer] : m_observers) {
+            observer(name, variable);
+        }
+    });
     m_variables[name] = std::move(variable);
 }
 
@@ -167,4 +169,105 @@ std::map<QString, const Variable *> VariableManager::variables() const
     return variables;
 }
 
+uint64_t VariableManager::addObserver(std::function<void(const QString &name, const Variable *variable)> observer)
+{
+    const auto id = m_nextObserverId++;
+    m_observers[id] = std::move(observer);
+    return id;
+}
+
+void VariableManager::removeObserver(uint64_t id)
+{
+    m_observers.erase(id);
+}
+
+void VariableManager::beginUsageAnalysis()
+{
+    m_referencedVariables = std::set<QString>();
+}
+
+void VariableManager::markUsed(const QString &name)
+{
+    if (m_referencedVariables) {
+        m_referencedVariables->insert(name);
+    }
+}
+
+void VariableManager::endUsageAnalysis(bool apply)
+{
+    if (!m_referencedVariables) {
+        return;
+    }
+
+    if (apply) {
+        std::set<const Variable *> used;
+        for (const auto &name : m_referencedVariables.value()) {
+            for (const auto *variable : variableWithParent(name)) {
+                used.insert(variable);
+            }
+        }
+        m_configVariables = std::move(used);
+        updateUsed();
+    }
+    m_referencedVariables = {};
+}
+
+void VariableManager::watch(const QString &name)
+{
+    for (const auto *variable : variableWithParent(name)) {
+        m_watchedVariables[variable]++;
+    }
+    updateUsed();
+}
+
+void VariableManager::unwatch(const QString &name)
+{
+    for (const auto *variable : variableWithParent(name)) {
+        if (const auto it = m_watchedVariables.find(variable); it != m_watchedVariables.end() && --it->second == 0) {
+            m_watchedVariables.erase(it);
+        }
+    }
+    updateUsed();
+}
+
+uint64_t VariableManager::addRefresher(std::function<void()> refresher)
+{
+    const auto id = m_nextRefresherId++;
+    m_refreshers[id] = std::move(refresher);
+    return id;
+}
+
+void VariableManager::removeRefresher(uint64_t id)
+{
+    m_refreshers.erase(id);
+}
+
+void VariableManager::refreshUnused()
+{
+    for (const auto &[_, refresher] : m_refreshers) {
+        refresher();
+    }
+}
+
+void VariableManager::updateUsed()
+{
+    for (const auto &[_, variable] : m_variables) {
+        const auto *ptr = variable.get();
+        variable->setUsed(!m_configVariables || m_configVariables->contains(ptr) || m_watchedVariables.contains(ptr));
+    }
+}
+
+std::vector<const Variable *> VariableManager::variableWithParent(const QString &name)
+{
+    const auto *variable = getVariable(name);
+    if (!variable) {
+        return {};
+    }
+
+    if (const auto *component = dynamic_cast<const PointComponentVariable *>(variable)) {
+        return {variable, component->parent()};
+    }
+    return {variable};
+}
+
 }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include <QString>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 
 Q_DECLARE_LOGGING_CATEGORY(INPUTACTIONS_VARIABLE_MANAGER)
 
@@ -57,7 +59,8 @@ struct BuiltinVariables
 };
 
 /**
- * Variables must be registered before loading the configuration file.
+ * Variables must be registered before loading the configuration file. Variables not referenced by the configuration or
+ * watched are marked as unused and may not be updated until refreshUnused is called.
  */
 class VariableManager
 {
@@ -120,8 +123,75 @@ public:
 
     std::map<QString, const Variable *> variables() const;
 
+    /**
+     * @param observer Called after the value of a variable changes. Changes of remote variables are only detected when
+     * they are read.
+     * @return ID to pass to removeObserver.
+     */
+    uint64_t addObserver(std::function<void(const QString &name, const Variable *variable)> observer);
+    void removeObserver(uint64_t id);
+
+    /**
+     * Starts recording which variables are referenced by conditions, expressions and values. Called before loading the
+     * configuration.
+     */
+    void beginUsageAnalysis();
+    /**
+     * Records that the variable is referenced. Does nothing if usage analysis has not been started.
+     */
+    void markUsed(const QString &name);
+    /**
+     * Stops recording variable references.
+     * @param apply Whether to mark the referenced variables as used and all other variables as unused. Should only be
+     * true if the configuration has been loaded successfully.
+     */
+    void endUsageAnalysis(bool apply);
+
+    /**
+     * Marks the variable as used until unwatch is called, regardless of whether the configuration references it. A
+     * variable can be watched multiple times.
+     */
+    void watch(const QString &name);
+    void unwatch(const QString &name);
+
+    /**
+     * @param refresher Sets the current values of variables whose updates are skipped while they are unused.
+     * @return ID to pass to removeRefresher.
+     */
+    uint64_t addRefresher(std::function<void()> refresher);
+    void removeRefresher(uint64_t id);
+    /**
+     * Brings unused variables up to date. Called before reading variables outside of the configuration.
+     */
+    void refreshUnused();
+
 private:
+    /**
+     * Marks the variables referenced by the configuration and the watched ones as used, and all others as unused.
+     */
+    void updateUsed();
+    /**
+     * @return The variable and the variable it is a component of, if any.
+     */
+    std::vector<const Variable *> variableWithParent(const QString &name);
+
     std::map<QString, std::unique_ptr<Variable>> m_variables;
+    std::optional<std::set<QString>> m_referencedVariables;
+    /**
+     * Variables referenced by the last successfully loaded configuration. Empty until a configuration is loaded, in which
+     * case all variables are used.
+     */
+    std::optional<std::set<const Variable *>> m_configVariables;
+    /**
+     * Variable -> number of watches.
+     */
+    std::map<const Variable *, uint32_t> m_watchedVariables;
+
+    std::map<uint64_t, std::function<void()>> m_refreshers;
+    uint64_t m_nextRefresherId{};
+
+    std::map<uint64_t, std::function<void(const QString &name, const Variable *variable)>> m_observers;
+    uint64_t m_nextObserverId{};
 };
 
 inline auto g_variableManager = std::make_shared<VariableManager>();
@@ -56,6 +56,14 @@ bool VariableOperationsBase::compare(const std::vector<std::any> &right, Compari
     }
 }
 
+bool VariableOperationsBase::equals(const std::any &left, const std::any &right) const
+{
+    if (!left.has_value() || !right.has_value()) {
+        return left.has_value() == right.has_value();
+    }
+    return compare(left, right, ComparisonOperator::EqualTo);
+}
+
 bool VariableOperationsBase::compare(const std::any &left, const std::any &right, ComparisonOperator comparisonOperator) const
 {
     return false;
@@ -162,7 +170,8 @@ bool VariableOperations<QString>::compare(const QString &left, const QString &ri
         case ComparisonOperator::Contains:
             return left.contains(right);
         case ComparisonOperator::EqualTo:
-            return left == right;
+            // Values often share data, e.g. device names and trigger IDs
+            return (left.constData() == right.constData() && left.size() == right.size()) || left == right;
         case ComparisonOperator::Regex:
             return QRegularExpression(right).match(left).hasMatch();
         default:
@@ -41,6 +41,10 @@ public:
      * exactly 1 value.
      */
     bool compare(const std::vector<std::any> &right, ComparisonOperator comparisonOperator) const;
+    /**
+     * @return Whether both values are equal. Empty values are only equal to other empty values.
+     */
+    bool equals(const std::any &left, const std::any &right) const;
     /**
      * @return A string representation of the variable's value or an empty string if not supported.
      */
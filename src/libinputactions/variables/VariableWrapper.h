@@ -41,6 +41,11 @@ public:
         return std::any_cast<T>(value);
     }
 
+    bool used() const
+    {
+        return m_variable->used();
+    }
+
     void set(const std::optional<T> &value)
     {
         if (!value.has_value()) {
@@ -21,6 +21,7 @@
 #include "yaml-cpp/yaml.h"
 #include <QRegularExpression>
 #include <QVector>
+#include <libinputactions/Config.h>
 #include <libinputactions/Expression.cpp>
 #include <libinputactions/Value.h>
 #include <libinputactions/actions/CommandTriggerAction.h>
@@ -29,6 +30,7 @@
 #include <libinputactions/actions/PlasmaGlobalShortcutTriggerAction.h>
 #include <libinputactions/conditions/ConditionGroup.h>
 #include <libinputactions/conditions/VariableCondition.h>
+#include <libinputactions/globals.h>
 #include <libinputactions/handlers/MouseTriggerHandler.h>
 #include <libinputactions/handlers/TouchpadTriggerHandler.h>
 #include <libinputactions/input/InputEventHandler.h>
@@ -725,7 +727,7 @@ struct convert<std::shared_ptr<Condition>>
                 for (const auto &child : groupChildren) {
                     group->add(child.as<std::shared_ptr<Condition>>());
                 }
-                condition = group;
+                condition = g_config->conditionInterner().intern(group);
                 return true;
             }
 
@@ -735,8 +737,8 @@ struct convert<std::shared_ptr<Condition>>
                 if (const auto &windowClassNode = node["window_class"]) {
                     const auto value = windowClassNode.as<QString>();
                     auto classGroup = std::make_shared<ConditionGroup>(ConditionGroupMode::Any);
-                    classGroup->add(std::make_shared<VariableCondition>("window_class", value, ComparisonOperator::Regex));
-                    classGroup->add(std::make_shared<VariableCondition>("window_name", value, ComparisonOperator::Regex));
+                    classGroup->add(g_config->conditionInterner().intern(std::make_shared<VariableCondition>("window_class", value, ComparisonOperator::Regex)));
+                    classGroup->add(g_config->conditionInterner().intern(std::make_shared<VariableCondition>("window_name", value, ComparisonOperator::Regex)));
                     classGroup->setNegate(negate.contains("window_class"));
                     group->add(classGroup);
                 }
@@ -744,10 +746,10 @@ struct convert<std::shared_ptr<Condition>>
                     const auto value = windowStateNode.as<QStringList>(QStringList());
                     auto classGroup = std::make_shared<ConditionGroup>(ConditionGroupMode::Any);
                     if (value.contains("fullscreen")) {
-                        classGroup->add(std::make_shared<VariableCondition>("window_fullscreen", true, ComparisonOperator::EqualTo));
+                        classGroup->add(g_config->conditionInterner().intern(std::make_shared<VariableCondition>("window_fullscreen", true, ComparisonOperator::EqualTo)));
                     }
                     if (value.contains("maximized")) {
-                        classGroup->add(std::make_shared<VariableCondition>("window_maximized", true, ComparisonOperator::EqualTo));
+                        classGroup->add(g_config->conditionInterner().intern(std::make_shared<VariableCondition>("window_maximized", true, ComparisonOperator::EqualTo)));
                     }
                     classGroup->setNegate(negate.contains("window_state"));
                     group->add(classGroup);
@@ -763,7 +765,7 @@ struct convert<std::shared_ptr<Condition>>
             for (const auto &child : node) {
                 group->add(child.as<std::shared_ptr<Condition>>());
             }
-            condition = group;
+            condition = g_config->conditionInterner().intern(group);
             return true;
         }
 
@@ -777,7 +779,7 @@ struct convert<std::shared_ptr<Condition>>
 
             const auto raw = conditionNode.as<QString>("");
             if (raw.startsWith("$") || raw.startsWith("!$")) {
-                condition = node.as<std::shared_ptr<VariableCondition>>();
+                condition = g_config->conditionInterner().intern(node.as<std::shared_ptr<VariableCondition>>());
                 return true;
             }
         }
@@ -930,11 +932,12 @@ struct convert<std::unique_ptr<Trigger>>
         if (const auto &fingersNode = node["fingers"]) {
             auto range = fingersNode.as<Range<qreal>>();
             if (!range.max()) {
-                conditionGroup->add(std::make_shared<VariableCondition>(BuiltinVariables::Fingers, range.min().value(), ComparisonOperator::EqualTo));
+                conditionGroup->add(
+                    g_config->conditionInterner().intern(std::make_shared<VariableCondition>(BuiltinVariables::Fingers, range.min().value(), ComparisonOperator::EqualTo)));
             } else {
-                conditionGroup->add(std::make_shared<VariableCondition>(BuiltinVariables::Fingers,
-                                                                        std::vector<std::any>{range.min().value(), range.max().value()},
-                                                                        ComparisonOperator::Between));
+                conditionGroup->add(g_config->conditionInterner().intern(std::make_shared<VariableCondition>(BuiltinVariables::Fingers,
+                                                                                                   std::vector<std::any>{range.min().value(), range.max().value()},
+                                                                                                   ComparisonOperator::Between)));
             }
         }
         if (const auto &thresholdNode = node["threshold"]) {
@@ -954,7 +957,8 @@ struct convert<std::unique_ptr<Trigger>>
             }
 
             if (modifiers) {
-                conditionGroup->add(std::make_shared<VariableCondition>(BuiltinVariables::KeyboardModifiers, modifiers.value(), ComparisonOperator::EqualTo));
+                conditionGroup->add(g_config->conditionInterner().intern(
+                    std::make_shared<VariableCondition>(BuiltinVariables::KeyboardModifiers, modifiers.value(), ComparisonOperator::EqualTo)));
             }
         }
         if (const auto &mouseButtonsNode = node["mouse_buttons"]) {
@@ -996,7 +1000,9 @@ struct convert<std::unique_ptr<TriggerAction>>
     static bool decode(const Node &node, std::unique_ptr<TriggerAction> &action)
     {
         if (node["command"].IsDefined()) {
-            action = std::make_unique<CommandTriggerAction>(node["command"].as<libinputactions::Value<QString>>());
+            auto commandAction = new CommandTriggerAction(node["command"].as<libinputactions::Value<QString>>());
+            commandAction->setCoalesce(node["coalesce"].as<bool>(false));
+            action.reset(commandAction);
         } else if (node["input"].IsDefined()) {
             auto inputAction = new InputTriggerAction;
             inputAction->setSequence(node["input"].as<std::vector<InputAction>>());
@@ -1087,11 +1093,18 @@ static void decodeMotionTriggerHandler(const Node &node, TriggerHandler *handler
 
     auto *motionHandler = dynamic_cast<MotionTriggerHandler *>(handler);
     if (const auto &speedNode = node["speed"]) {
-        if (const auto &eventsNode = speedNode["events"]) {
-            motionHandler->setSpeedInputEventsToSample(eventsNode.as<uint8_t>());
+        if (const auto &windowNode = speedNode["window"]) {
+            motionHandler->setSpeedWindow(std::chrono::milliseconds(windowNode.as<uint32_t>()));
+        } else if (const auto &eventsNode = speedNode["events"]) {
+            // Deprecated, assume one event per 10 ms
+            motionHandler->setSpeedWindow(std::chrono::milliseconds(eventsNode.as<uint8_t>() * 10));
         }
-        if (const auto &thresholdNode = speedNode["swipe_threshold"]) {
-            motionHandler->setSpeedThreshold(TriggerType::Swipe, thresholdNode.as<qreal>());
+        // Distance per 10 ms
+        if (const auto &velocityNode = speedNode["swipe_velocity"]) {
+            motionHandler->setSpeedThreshold(TriggerType::Swipe, velocityNode.as<qreal>());
+        } else if (const auto &thresholdNode = speedNode["swipe_threshold"]) {
+            qCWarning(INPUTACTIONS, "speed.swipe_threshold is deprecated, use speed.swipe_velocity (distance per 10 ms) instead");
+            motionHandler->setSpeedThresholdPerEvent(TriggerType::Swipe, thresholdNode.as<qreal>());
         }
     }
 }
@@ -1418,7 +1431,17 @@ struct convert<libinputactions::Value<T>>
     {
         if (node.IsMap()) {
             if (const auto &commandNode = node["command"]) {
-                value = libinputactions::Value<T>::command(commandNode.as<libinputactions::Value<QString>>());
+                CommandValueOptions options;
+                if (const auto &ttlNode = node["ttl"]) {
+                    options.ttl = ttlNode.as<uint32_t>();
+                }
+                if (const auto &timeoutNode = node["timeout"]) {
+                    options.timeout = timeoutNode.as<uint32_t>();
+                }
+                if (const auto &prefetchNode = node["prefetch"]) {
+                    options.prefetch = prefetchNode.as<bool>();
+                }
+                value = libinputactions::Value<T>::command(commandNode.as<libinputactions::Value<QString>>(), options);
             }
         } else {
             const auto raw = node.as<QString>();
@@ -0,0 +1,85 @@
+#include "TestCommandSpawner.h"
+#include <QElapsedTimer>
+#include <QFile>
+
+namespace libinputactions
+{
+
+void TestCommandSpawner::init()
+{
+    m_spawner = std::make_unique<CommandSpawner>();
+    m_dir = std::make_unique<QTemporaryDir>();
+}
+
+void TestCommandSpawner::spawn_direct()
+{
+    const auto path = m_dir->filePath("direct");
+    m_spawner->spawn("touch " + path);
+    QTRY_VERIFY(QFile::exists(path));
+}
+
+void TestCommandSpawner::spawn_shell()
+{
+    const auto path = m_dir->filePath("shell");
+    m_spawner->spawn("echo test > " + path);
+    QTRY_VERIFY(QFile::exists(path));
+}
+
+void TestCommandSpawner::spawn_commandValue_doesNotBlock()
+{
+    const auto path = m_dir->filePath("value");
+    QElapsedTimer timer;
+    timer.start();
+    m_spawner->spawn(Value<QString>::command(QString("sleep 1; echo touch " + path)));
+    QVERIFY(timer.elapsed() < 500);
+
+    QTRY_VERIFY_WITH_TIMEOUT(QFile::exists(path), 5000);
+}
+
+void TestCommandSpawner::spawn_maxPendingCommands_queues()
+{
+    m_spawner->setMaxPendingCommands(1);
+    const auto first = m_dir->filePath("first");
+    const auto second = m_dir->filePath("second");
+    m_spawner->spawn(Value<QString>::command(QString("sleep 0.2; echo true")));
+    m_spawner->spawn("touch " + first);
+    m_spawner->spawn("touch " + second);
+
+    QVERIFY(!QFile::exists(first));
+    QTRY_VERIFY(QFile::exists(first));
+    QTRY_VERIFY(QFile::exists(second));
+}
+
+void TestCommandSpawner::spawn_maxPendingCommands_ignoresRunningCommands()
+{
+    m_spawner->setMaxPendingCommands(1);
+    const auto path = m_dir->filePath("path");
+    m_spawner->spawn(QString("sleep 2"));
+    m_spawner->spawn("touch " + path);
+
+    QTRY_VERIFY_WITH_TIMEOUT(QFile::exists(path), 1000);
+}
+
+void TestCommandSpawner::spawn_queueFull_dropsOldestFromSource()
+{
+    m_spawner->setMaxPendingCommands(1);
+    m_spawner->setMaxQueuedCommands(2);
+    const int source1{};
+    const int source2{};
+    const auto dropped = m_dir->filePath("dropped");
+    const auto second = m_dir->filePath("second");
+    const auto third = m_dir->filePath("third");
+    m_spawner->spawn(Value<QString>::command(QString("sleep 0.2; echo true")));
+    m_spawner->spawn("touch " + dropped, &source1);
+    m_spawner->spawn("touch " + second, &source2);
+    m_spawner->spawn("touch " + third, &source1);
+
+    QTRY_VERIFY(QFile::exists(second));
+    QTRY_VERIFY(QFile::exists(third));
+    QVERIFY(!QFile::exists(dropped));
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestCommandSpawner)
+#include "TestCommandSpawner.moc"
\ No newline at end of file
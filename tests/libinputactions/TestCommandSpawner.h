@@ -0,0 +1,30 @@
+#pragma once
+
+#include <libinputactions/CommandSpawner.h>
+
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestCommandSpawner : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void spawn_direct();
+    void spawn_shell();
+    void spawn_commandValue_doesNotBlock();
+    void spawn_maxPendingCommands_queues();
+    void spawn_maxPendingCommands_ignoresRunningCommands();
+    void spawn_queueFull_dropsOldestFromSource();
+
+private:
+    std::unique_ptr<CommandSpawner> m_spawner;
+    std::unique_ptr<QTemporaryDir> m_dir;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "TestExpression.h"
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+void TestExpression::initTestCase()
+{
+    g_variableManager->registerLocalVariable<QString>("test");
+    g_variableManager->registerLocalVariable<qreal>("test_number");
+    g_variableManager->getVariable<QString>("test")->set("value");
+    g_variableManager->getVariable<qreal>("test_number")->set(2);
+}
+
+void TestExpression::evaluate_string_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<QString>("result");
+
+    QTest::addRow("empty") << "" << "";
+    QTest::addRow("no variables") << "notify test" << "notify test";
+    QTest::addRow("only variable") << "$test" << "value";
+    QTest::addRow("variable at start") << "$test end" << "value end";
+    QTest::addRow("variable at end") << "notify $test" << "notify value";
+    QTest::addRow("variable followed by symbol") << "notify $test." << "notify value.";
+    QTest::addRow("multiple variables") << "$test $test_number $test" << "value 2 value";
+    QTest::addRow("adjacent variables") << "$test$test" << "valuevalue";
+    QTest::addRow("unknown variable") << "notify $unknown $test" << "notify $unknown value";
+    QTest::addRow("unknown variable with known prefix") << "notify $test_unknown" << "notify $test_unknown";
+    QTest::addRow("dollar sign") << "$ $$test" << "$ $value";
+}
+
+void TestExpression::evaluate_string()
+{
+    QFETCH(QString, expression);
+    QFETCH(QString, result);
+
+    QCOMPARE(Expression<QString>(expression).evaluate(), result);
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestExpression)
+#include "TestExpression.moc"
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <libinputactions/Expression.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestExpression : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void evaluate_string_data();
+    void evaluate_string();
+};
+
+}
\ No newline at end of file
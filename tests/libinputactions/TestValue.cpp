@@ -0,0 +1,59 @@
+#include "TestValue.h"
+#include <QElapsedTimer>
+#include <optional>
+
+namespace libinputactions
+{
+
+void TestValue::command()
+{
+    const auto value = Value<QString>::command(QString("echo test"), {.timeout = 5000});
+    QCOMPARE(value.get(), QString("test\n"));
+}
+
+void TestValue::command_ttl()
+{
+    const auto value = Value<QString>::command(QString("date +%s%N"), {.ttl = 60000, .timeout = 5000});
+    const auto output = value.get();
+    QVERIFY(!output.isEmpty());
+    QCOMPARE(value.get(), output);
+}
+
+void TestValue::command_timeout()
+{
+    const auto value = Value<QString>::command(QString("sleep 1; echo test"), {.timeout = 0});
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(value.get().isEmpty());
+    QVERIFY(timer.elapsed() < 500);
+
+    QTRY_COMPARE_WITH_TIMEOUT(value.get(), QString("test\n"), 5000);
+}
+
+void TestValue::command_noTimeout()
+{
+    const auto value = Value<QString>::command(QString("sleep 1; echo test"));
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(value.get().isEmpty());
+    QVERIFY(timer.elapsed() < 500);
+
+    QTRY_COMPARE_WITH_TIMEOUT(value.get(), QString("test\n"), 5000);
+}
+
+void TestValue::command_getAsync()
+{
+    const auto value = Value<QString>::command(QString("sleep 0.2; echo test"));
+    std::optional<QString> output;
+    value.getAsync([&output](const QString &value) {
+        output = value;
+    });
+    QVERIFY(!output);
+
+    QTRY_COMPARE_WITH_TIMEOUT(output.value_or(QString()), QString("test\n"), 5000);
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestValue)
+#include "TestValue.moc"
\ No newline at end of file
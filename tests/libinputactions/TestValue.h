@@ -0,0 +1,22 @@
+#pragma once
+
+#include <libinputactions/Value.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestValue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void command();
+    void command_ttl();
+    void command_timeout();
+    void command_noTimeout();
+    void command_getAsync();
+};
+
+}
\ No newline at end of file
@@ -49,7 +49,7 @@ void TestTriggerAction::tryExecute_canExecute_executes()
 {
     ON_CALL(*m_action, canExecute())
         .WillByDefault(Return(true));
-    EXPECT_CALL(*m_action, execute())
+    EXPECT_CALL(*m_action, execute(1))
         .Times(Exactly(1));
 
     m_action->TriggerAction::tryExecute();
@@ -61,7 +61,7 @@ void TestTriggerAction::tryExecute_cantExecute_doesntExecute()
 {
     ON_CALL(*m_action, canExecute())
         .WillByDefault(Return(false));
-    EXPECT_CALL(*m_action, execute())
+    EXPECT_CALL(*m_action, execute(_))
         .Times(Exactly(0));
 
     m_action->TriggerAction::tryExecute();
@@ -86,7 +86,7 @@ void TestTriggerAction::gestureStarted()
     QFETCH(On, on);
     QFETCH(bool, executes);
 
-    EXPECT_CALL(*m_action, tryExecute())
+    EXPECT_CALL(*m_action, tryExecute(1))
         .Times(Exactly(executes ? 1 : 0));
 
     m_action->setOn(on);
@@ -119,8 +119,11 @@ void TestTriggerAction::gestureUpdated()
     QFETCH(ActionInterval, interval);
     QFETCH(int, executions);
 
-    EXPECT_CALL(*m_action, tryExecute())
-        .Times(Exactly(executions));
+    int actualExecutions{};
+    EXPECT_CALL(*m_action, tryExecute(_))
+        .WillRepeatedly([&actualExecutions](uint32_t executions) {
+            actualExecutions += executions;
+        });
 
     m_action->setOn(On::Update);
     m_action->setRepeatInterval(interval);
@@ -129,6 +132,22 @@ void TestTriggerAction::gestureUpdated()
         m_action->TriggerAction::triggerUpdated(delta, {});
     }
 
+    QCOMPARE(actualExecutions, executions);
+    QVERIFY(Mock::VerifyAndClearExpectations(m_action.get()));
+}
+
+void TestTriggerAction::gestureUpdated_multipleExecutions_executesOnce()
+{
+    ActionInterval interval{};
+    interval.setValue(2);
+
+    EXPECT_CALL(*m_action, tryExecute(5))
+        .Times(Exactly(1));
+
+    m_action->setOn(On::Update);
+    m_action->setRepeatInterval(interval);
+    m_action->TriggerAction::triggerUpdated(11, {});
+
     QVERIFY(Mock::VerifyAndClearExpectations(m_action.get()));
 }
 
@@ -149,7 +168,7 @@ void TestTriggerAction::gestureEnded()
     QFETCH(On, on);
     QFETCH(bool, executes);
 
-    EXPECT_CALL(*m_action, tryExecute)
+    EXPECT_CALL(*m_action, tryExecute(1))
         .Times(Exactly(executes ? 1 : 0));
 
     m_action->setOn(on);
@@ -175,7 +194,7 @@ void TestTriggerAction::gestureCancelled()
     QFETCH(On, on);
     QFETCH(bool, executes);
 
-    EXPECT_CALL(*m_action, tryExecute)
+    EXPECT_CALL(*m_action, tryExecute(1))
         .Times(Exactly(executes ? 1 : 0));
 
     m_action->setOn(on);
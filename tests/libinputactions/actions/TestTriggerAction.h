@@ -25,6 +25,7 @@ private slots:
 
     void gestureUpdated_data();
     void gestureUpdated();
+    void gestureUpdated_multipleExecutions_executesOnce();
 
     void gestureEnded_data();
     void gestureEnded();
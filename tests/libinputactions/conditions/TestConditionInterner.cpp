@@ -0,0 +1,104 @@
+#include "TestConditionInterner.h"
+
+#include "utils.h"
+
+#include <libinputactions/conditions/ConditionGroup.h>
+#include <libinputactions/conditions/VariableCondition.h>
+#include <libinputactions/globals.h>
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+static std::shared_ptr<VariableCondition> makeVariableCondition(qreal value, ComparisonOperator comparisonOperator = ComparisonOperator::EqualTo)
+{
+    return std::make_shared<VariableCondition>("test_interner", std::any(value), comparisonOperator);
+}
+
+void TestConditionInterner::initTestCase()
+{
+    g_variableManager->registerLocalVariable<qreal>("test_interner");
+}
+
+void TestConditionInterner::init()
+{
+    m_interner = std::make_unique<ConditionInterner>();
+}
+
+void TestConditionInterner::intern_identicalVariableConditions_returnsSameCondition()
+{
+    const auto first = m_interner->intern(makeVariableCondition(1));
+    const auto second = m_interner->intern(makeVariableCondition(1));
+
+    QVERIFY(first == second);
+}
+
+void TestConditionInterner::intern_differentVariableConditions_returnsDifferentConditions_data()
+{
+    QTest::addColumn<std::shared_ptr<VariableCondition>>("condition");
+
+    QTest::newRow("value") << makeVariableCondition(2);
+    QTest::newRow("operator") << makeVariableCondition(1, ComparisonOperator::GreaterThan);
+    QTest::newRow("variable") << std::make_shared<VariableCondition>(BuiltinVariables::Fingers, std::any(static_cast<qreal>(1)), ComparisonOperator::EqualTo);
+
+    auto negated = makeVariableCondition(1);
+    negated->setNegate(true);
+    QTest::newRow("negate") << negated;
+}
+
+void TestConditionInterner::intern_differentVariableConditions_returnsDifferentConditions()
+{
+    QFETCH(std::shared_ptr<VariableCondition>, condition);
+
+    const auto first = m_interner->intern(makeVariableCondition(1));
+    const auto second = m_interner->intern(condition);
+
+    QVERIFY(first != second);
+}
+
+void TestConditionInterner::intern_identicalGroups_returnsSameCondition()
+{
+    const auto makeGroup = [this](ConditionGroupMode mode) {
+        auto group = std::make_shared<ConditionGroup>(mode);
+        group->add(m_interner->intern(makeVariableCondition(1)));
+        group->add(m_interner->intern(makeVariableCondition(2)));
+        return m_interner->intern(group);
+    };
+
+    QVERIFY(makeGroup(ConditionGroupMode::Any) == makeGroup(ConditionGroupMode::Any));
+    QVERIFY(makeGroup(ConditionGroupMode::Any) != makeGroup(ConditionGroupMode::All));
+}
+
+void TestConditionInterner::intern_callbackCondition_returnsSameCondition()
+{
+    const auto condition = makeCondition(true);
+
+    QVERIFY(m_interner->intern(condition) == condition);
+    QVERIFY(m_interner->intern(makeCondition(true)) != condition);
+}
+
+void TestConditionInterner::compare_evaluationScope_memoizesResult()
+{
+    uint32_t reads{};
+    g_variableManager->registerRemoteVariable<qreal>("test_interner_remote", [&reads](auto &value) {
+        reads++;
+        value = 1;
+    });
+    const auto condition = std::make_shared<VariableCondition>("test_interner_remote", std::any(static_cast<qreal>(1)), ComparisonOperator::EqualTo);
+
+    {
+        const ConditionEvaluationScope scope;
+        QVERIFY(condition->satisfied());
+        QVERIFY(condition->satisfied());
+        QCOMPARE(reads, 1u);
+    }
+
+    QVERIFY(condition->satisfied());
+    QVERIFY(condition->satisfied());
+    QCOMPARE(reads, 3u);
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestConditionInterner)
+#include "TestConditionInterner.moc"
\ No newline at end of file
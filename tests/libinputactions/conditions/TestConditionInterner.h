@@ -0,0 +1,30 @@
+#pragma once
+
+#include <libinputactions/conditions/ConditionInterner.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestConditionInterner : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+
+    void intern_identicalVariableConditions_returnsSameCondition();
+    void intern_differentVariableConditions_returnsDifferentConditions_data();
+    void intern_differentVariableConditions_returnsDifferentConditions();
+    void intern_identicalGroups_returnsSameCondition();
+    void intern_callbackCondition_returnsSameCondition();
+
+    void compare_evaluationScope_memoizesResult();
+
+private:
+    std::unique_ptr<ConditionInterner> m_interner;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "TestConditionProgram.h"
+
+#include "utils.h"
+
+#include <libinputactions/conditions/CallbackCondition.h>
+#include <libinputactions/conditions/ConditionGroup.h>
+#include <libinputactions/conditions/ConditionProgram.h>
+#include <libinputactions/conditions/VariableCondition.h>
+#include <libinputactions/globals.h>
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+static std::shared_ptr<ConditionGroup> makeGroup(ConditionGroupMode mode, const std::vector<std::shared_ptr<Condition>> &conditions, bool negate = false)
+{
+    auto group = std::make_shared<ConditionGroup>(mode);
+    for (const auto &condition : conditions) {
+        group->add(condition);
+    }
+    group->setNegate(negate);
+    return group;
+}
+
+static std::shared_ptr<Condition> makeNegatedCondition(bool result)
+{
+    auto condition = makeCondition(result);
+    condition->setNegate(true);
+    return condition;
+}
+
+void TestConditionProgram::evaluate_data()
+{
+    QTest::addColumn<std::shared_ptr<Condition>>("condition");
+
+    for (const auto &mode : {ConditionGroupMode::All, ConditionGroupMode::Any, ConditionGroupMode::None}) {
+        const auto modeName = mode == ConditionGroupMode::All ? "all" : mode == ConditionGroupMode::Any ? "any" : "none";
+        for (const auto &negate : {false, true}) {
+            const auto name = QString("%1%2").arg(negate ? "!" : "", modeName);
+            QTest::newRow(qPrintable(name + ", empty")) << std::shared_ptr<Condition>(makeGroup(mode, {}, negate));
+            QTest::newRow(qPrintable(name + ", true")) << std::shared_ptr<Condition>(makeGroup(mode, {makeCondition(true)}, negate));
+            QTest::newRow(qPrintable(name + ", false")) << std::shared_ptr<Condition>(makeGroup(mode, {makeCondition(false)}, negate));
+            QTest::newRow(qPrintable(name + ", true false")) << std::shared_ptr<Condition>(makeGroup(mode, {makeCondition(true), makeCondition(false)}, negate));
+            QTest::newRow(qPrintable(name + ", false true")) << std::shared_ptr<Condition>(makeGroup(mode, {makeCondition(false), makeCondition(true)}, negate));
+            QTest::newRow(qPrintable(name + ", true true true"))
+                << std::shared_ptr<Condition>(makeGroup(mode, {makeCondition(true), makeCondition(true), makeCondition(true)}, negate));
+            QTest::newRow(qPrintable(name + ", !true !false"))
+                << std::shared_ptr<Condition>(makeGroup(mode, {makeNegatedCondition(true), makeNegatedCondition(false)}, negate));
+        }
+    }
+
+    QTest::newRow("all, any, none") << std::shared_ptr<Condition>(makeGroup(ConditionGroupMode::All,
+                                                                             {
+                                                                                 makeCondition(true),
+                                                                                 makeGroup(ConditionGroupMode::Any, {makeCondition(false), makeCondition(true)}),
+                                                                                 makeGroup(ConditionGroupMode::None, {makeCondition(false)}),
+                                                                             }));
+    QTest::newRow("any, !all, !any") << std::shared_ptr<Condition>(makeGroup(ConditionGroupMode::Any,
+                                                                              {
+                                                                                  makeGroup(ConditionGroupMode::All, {makeCondition(true), makeCondition(true)}, true),
+                                                                                  makeGroup(ConditionGroupMode::Any, {makeCondition(false)}, true),
+                                                                              }));
+    QTest::newRow("none, all, any") << std::shared_ptr<Condition>(makeGroup(ConditionGroupMode::None,
+                                                                             {
+                                                                                 makeGroup(ConditionGroupMode::All, {makeCondition(true), makeCondition(false)}),
+                                                                                 makeGroup(ConditionGroupMode::Any, {makeCondition(false), makeCondition(false)}),
+                                                                             }));
+    QTest::newRow("all, all, all") << std::shared_ptr<Condition>(
+        makeGroup(ConditionGroupMode::All, {makeGroup(ConditionGroupMode::All, {makeGroup(ConditionGroupMode::All, {makeCondition(true)})}), makeCondition(true)}));
+    QTest::newRow("callback") << makeCondition(true);
+    QTest::newRow("!callback") << makeNegatedCondition(true);
+}
+
+void TestConditionProgram::evaluate()
+{
+    QFETCH(std::shared_ptr<Condition>, condition);
+
+    const ConditionProgram program(condition);
+    QCOMPARE(program.evaluate(), condition->satisfied());
+}
+
+void TestConditionProgram::evaluate_shortCircuits()
+{
+    uint32_t evaluations{};
+    const auto counted = std::make_shared<CallbackCondition>([&evaluations]() {
+        evaluations++;
+        return true;
+    });
+
+    QVERIFY(!ConditionProgram(makeGroup(ConditionGroupMode::All, {makeCondition(false), counted})).evaluate());
+    QVERIFY(ConditionProgram(makeGroup(ConditionGroupMode::Any, {makeCondition(true), counted})).evaluate());
+    QVERIFY(!ConditionProgram(makeGroup(ConditionGroupMode::None, {makeCondition(true), counted})).evaluate());
+    QCOMPARE(evaluations, 0u);
+
+    QVERIFY(ConditionProgram(makeGroup(ConditionGroupMode::All, {makeCondition(true), counted})).evaluate());
+    QCOMPARE(evaluations, 1u);
+}
+
+void TestConditionProgram::evaluate_cheapConditionsFirst()
+{
+    g_variableManager->registerLocalVariable<qreal>("test_cost");
+    g_variableManager->getVariable<qreal>("test_cost")->set(1);
+    const auto cheap = std::make_shared<VariableCondition>("test_cost", std::any(static_cast<qreal>(2)), ComparisonOperator::EqualTo);
+
+    uint32_t evaluations{};
+    const auto expensive = std::make_shared<CallbackCondition>([&evaluations]() {
+        evaluations++;
+        return true;
+    });
+
+    QVERIFY(!ConditionProgram(makeGroup(ConditionGroupMode::All, {expensive, cheap})).evaluate());
+    QVERIFY(ConditionProgram(makeGroup(ConditionGroupMode::Any, {expensive, makeGroup(ConditionGroupMode::None, {cheap})})).evaluate());
+    QCOMPARE(evaluations, 0u);
+}
+
+void TestConditionProgram::evaluate_variable()
+{
+    g_variableManager->registerLocalVariable<qreal>("test_program");
+    const auto variable = g_variableManager->getVariable<qreal>("test_program");
+    const auto condition = std::make_shared<VariableCondition>("test_program", std::any(static_cast<qreal>(1)), ComparisonOperator::EqualTo);
+    const ConditionProgram program(condition);
+
+    variable->set(1);
+    QVERIFY(program.evaluate());
+
+    variable->set(2);
+    QVERIFY(!program.evaluate());
+
+    condition->setNegate(true);
+    const ConditionProgram negatedProgram(condition);
+    QVERIFY(negatedProgram.evaluate());
+}
+
+void TestConditionProgram::evaluate_variableSetToSameValue()
+{
+    g_variableManager->registerLocalVariable<QString>("test_program_same");
+    const auto variable = g_variableManager->getVariable("test_program_same");
+    const ConditionProgram program(std::make_shared<VariableCondition>("test_program_same", std::any(QString("a")), ComparisonOperator::EqualTo));
+
+    variable->set(QString("a"));
+    QVERIFY(program.evaluate());
+    const auto version = variable->version();
+
+    variable->set(QString("a"));
+    QCOMPARE(variable->version(), version);
+    QVERIFY(program.evaluate());
+
+    variable->set(QString("b"));
+    QVERIFY(variable->version() != version);
+    QVERIFY(!program.evaluate());
+}
+
+void TestConditionProgram::evaluate_remoteVariable()
+{
+    qreal value = 1;
+    uint32_t reads{};
+    g_variableManager->registerRemoteVariable<qreal>("test_program_remote", [&value, &reads](auto &result) {
+        result = value;
+        reads++;
+    });
+    const ConditionProgram program(std::make_shared<VariableCondition>("test_program_remote", std::any(static_cast<qreal>(1)), ComparisonOperator::EqualTo));
+
+    QVERIFY(program.evaluate());
+    QVERIFY(program.evaluate());
+
+    value = 2;
+    reads = 0;
+    QVERIFY(!program.evaluate());
+    QCOMPARE(reads, 1);
+
+    value = 1;
+    QVERIFY(program.evaluate());
+}
+
+void TestConditionProgram::evaluate_remoteVariable_shortCircuits()
+{
+    g_variableManager->registerLocalVariable<qreal>("test_program_local");
+    const auto local = g_variableManager->getVariable<qreal>("test_program_local");
+    local->set(1);
+    uint32_t reads{};
+    g_variableManager->registerRemoteVariable<qreal>("test_program_remote_skipped", [&reads](auto &result) {
+        result = static_cast<qreal>(1);
+        reads++;
+    });
+    const ConditionProgram program(makeGroup(ConditionGroupMode::All,
+                                             {std::make_shared<VariableCondition>("test_program_remote_skipped", std::any(static_cast<qreal>(1)), ComparisonOperator::EqualTo),
+                                              std::make_shared<VariableCondition>("test_program_local", std::any(static_cast<qreal>(2)), ComparisonOperator::EqualTo)}));
+
+    QVERIFY(!program.evaluate());
+    QVERIFY(!program.evaluate());
+    QCOMPARE(reads, 0u);
+
+    local->set(2);
+    QVERIFY(program.evaluate());
+    QCOMPARE(reads, 1u);
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestConditionProgram)
+#include "TestConditionProgram.moc"
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <libinputactions/conditions/Condition.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestConditionProgram : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void evaluate_data();
+    void evaluate();
+
+    void evaluate_shortCircuits();
+    void evaluate_cheapConditionsFirst();
+    void evaluate_variable();
+    void evaluate_variableSetToSameValue();
+    void evaluate_remoteVariable();
+    void evaluate_remoteVariable_shortCircuits();
+};
+
+}
\ No newline at end of file
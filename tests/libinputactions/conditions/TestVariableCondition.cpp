@@ -0,0 +1,133 @@
+#include "TestVariableCondition.h"
+
+#include <libinputactions/conditions/ConditionInterner.h>
+#include <libinputactions/conditions/VariableCondition.h>
+#include <libinputactions/globals.h>
+#include <libinputactions/variables/VariableManager.h>
+
+namespace libinputactions
+{
+
+void TestVariableCondition::initTestCase()
+{
+    g_variableManager->registerRemoteVariable<QString>("test_string", [this](auto &value) {
+        value = m_value;
+    });
+}
+
+void TestVariableCondition::oneOf_string_data()
+{
+    QTest::addColumn<QString>("value");
+    QTest::addColumn<bool>("result");
+
+    QTest::newRow("first") << "firefox" << true;
+    QTest::newRow("last") << "kitty" << true;
+    QTest::newRow("not in list") << "konsole" << false;
+    QTest::newRow("case") << "Firefox" << false;
+    QTest::newRow("empty") << "" << false;
+}
+
+void TestVariableCondition::oneOf_string()
+{
+    QFETCH(QString, value);
+    QFETCH(bool, result);
+
+    const VariableCondition condition("test_string", std::vector<std::any>{QString("firefox"), QString("dolphin"), QString("kitty")}, ComparisonOperator::OneOf);
+    m_value = value;
+
+    QCOMPARE(condition.satisfied(), result);
+}
+
+void TestVariableCondition::regex_data()
+{
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<QString>("value");
+    QTest::addColumn<bool>("result");
+
+    QTest::newRow("substring") << "fire" << "firefox" << true;
+    QTest::newRow("anchored") << "^fox" << "firefox" << false;
+    QTest::newRow("alternative") << "dolphin|firefox" << "firefox" << true;
+    QTest::newRow("backreference") << "(o)\\1" << "foo" << true;
+    QTest::newRow("invalid") << "(" << "(" << false;
+}
+
+void TestVariableCondition::regex()
+{
+    QFETCH(QString, pattern);
+    QFETCH(QString, value);
+    QFETCH(bool, result);
+
+    const VariableCondition condition("test_string", pattern, ComparisonOperator::Regex);
+    m_value = value;
+
+    QCOMPARE(condition.satisfied(), result);
+}
+
+void TestVariableCondition::regex_sharedMatcher_data()
+{
+    QTest::addColumn<QString>("value");
+    QTest::addColumn<std::vector<bool>>("results");
+
+    QTest::newRow("none") << "konsole" << std::vector<bool>{false, false, false, false, false};
+    QTest::newRow("first") << "firefox" << std::vector<bool>{true, false, false, true, false};
+    QTest::newRow("second") << "dolphin" << std::vector<bool>{false, true, false, false, false};
+    QTest::newRow("backreference") << "kitty" << std::vector<bool>{false, false, true, false, false};
+    QTest::newRow("recursion") << "foo" << std::vector<bool>{false, false, false, false, true};
+    QTest::newRow("multiple") << "dolphin firefox" << std::vector<bool>{false, true, false, true, false};
+}
+
+void TestVariableCondition::regex_sharedMatcher()
+{
+    QFETCH(QString, value);
+    QFETCH(std::vector<bool>, results);
+
+    ConditionInterner interner;
+    const std::vector<std::shared_ptr<Condition>> conditions{
+        interner.intern(std::make_shared<VariableCondition>("test_string", QString("^fire"), ComparisonOperator::Regex)),
+        interner.intern(std::make_shared<VariableCondition>("test_string", QString("(d)olph"), ComparisonOperator::Regex)),
+        interner.intern(std::make_shared<VariableCondition>("test_string", QString("(t)\\1"), ComparisonOperator::Regex)),
+        interner.intern(std::make_shared<VariableCondition>("test_string", QString("(?i)FOX$"), ComparisonOperator::Regex)),
+        interner.intern(std::make_shared<VariableCondition>("test_string", QString("(o)(?1)"), ComparisonOperator::Regex)),
+    };
+    m_value = value;
+
+    for (size_t i = 0; i < conditions.size(); i++) {
+        QCOMPARE(conditions[i]->satisfied(), results[i]);
+    }
+
+    const ConditionEvaluationScope scope;
+    for (size_t i = 0; i < conditions.size(); i++) {
+        QCOMPARE(conditions[i]->satisfied(), results[i]);
+    }
+}
+
+void TestVariableCondition::regex_sharedMatcher_onePatternPerScope()
+{
+    ConditionInterner interner;
+    const auto first = interner.intern(std::make_shared<VariableCondition>("test_string", QString("^fire"), ComparisonOperator::Regex));
+    const auto second = interner.intern(std::make_shared<VariableCondition>("test_string", QString("olph"), ComparisonOperator::Regex));
+
+    m_value = "firefox";
+    {
+        const ConditionEvaluationScope scope;
+        QVERIFY(first->satisfied());
+        QVERIFY(first->satisfied());
+    }
+
+    m_value = "dolphin";
+    {
+        const ConditionEvaluationScope scope;
+        QVERIFY(second->satisfied());
+        QVERIFY(!first->satisfied());
+    }
+    {
+        const ConditionEvaluationScope scope;
+        QVERIFY(!first->satisfied());
+        QVERIFY(second->satisfied());
+    }
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestVariableCondition)
+#include "TestVariableCondition.moc"
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <libinputactions/conditions/Condition.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestVariableCondition : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void oneOf_string_data();
+    void oneOf_string();
+
+    void regex_data();
+    void regex();
+
+    void regex_sharedMatcher_data();
+    void regex_sharedMatcher();
+    void regex_sharedMatcher_onePatternPerScope();
+
+private:
+    QString m_value;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "TestMotionTriggerHandler.h"
+
+using namespace std::chrono_literals;
+
+namespace libinputactions
+{
+
+void TestMotionTriggerHandler::init()
+{
+    m_handler = std::make_unique<TestableMotionTriggerHandler>();
+    m_handler->setSpeedThreshold(TriggerType::Swipe, 20);
+    m_handler->setSpeedWindow(30ms);
+
+    m_trigger = std::make_unique<MotionTrigger>();
+    m_trigger->setSpeed(TriggerSpeed::Fast);
+    m_handler->triggerActivating(m_trigger.get());
+}
+
+void TestMotionTriggerHandler::determineSpeed_fastMotion_determinedBeforeWindowEnds()
+{
+    TriggerSpeed speed{};
+
+    QVERIFY(!m_handler->determineSpeed(TriggerType::Swipe, 40, 0us, speed));
+    QVERIFY(!m_handler->determineSpeed(TriggerType::Swipe, 40, 5ms, speed));
+    QVERIFY(m_handler->determineSpeed(TriggerType::Swipe, 40, 10ms, speed));
+    QCOMPARE(speed, TriggerSpeed::Fast);
+}
+
+void TestMotionTriggerHandler::determineSpeed_slowMotion_determinedAfterWindow()
+{
+    TriggerSpeed speed{};
+
+    QVERIFY(!m_handler->determineSpeed(TriggerType::Swipe, 5, 0us, speed));
+    QVERIFY(!m_handler->determineSpeed(TriggerType::Swipe, 5, 10ms, speed));
+    QVERIFY(!m_handler->determineSpeed(TriggerType::Swipe, 5, 20ms, speed));
+    QVERIFY(m_handler->determineSpeed(TriggerType::Swipe, 5, 30ms, speed));
+    QCOMPARE(speed, TriggerSpeed::Slow);
+}
+
+void TestMotionTriggerHandler::determineSpeed_eventRate_data()
+{
+    QTest::addColumn<qint64>("interval");
+    QTest::addColumn<qreal>("velocity");
+    QTest::addColumn<TriggerSpeed>("speed");
+
+    // Velocity is the distance per 10 ms
+    QTest::newRow("125 Hz, slow") << static_cast<qint64>(8000) << 15.0 << TriggerSpeed::Slow;
+    QTest::newRow("125 Hz, fast") << static_cast<qint64>(8000) << 25.0 << TriggerSpeed::Fast;
+    QTest::newRow("1 kHz, slow") << static_cast<qint64>(1000) << 15.0 << TriggerSpeed::Slow;
+    QTest::newRow("1 kHz, fast") << static_cast<qint64>(1000) << 25.0 << TriggerSpeed::Fast;
+    QTest::newRow("8 kHz, slow") << static_cast<qint64>(125) << 15.0 << TriggerSpeed::Slow;
+    QTest::newRow("8 kHz, fast") << static_cast<qint64>(125) << 25.0 << TriggerSpeed::Fast;
+}
+
+void TestMotionTriggerHandler::determineSpeed_eventRate()
+{
+    QFETCH(qint64, interval);
+    QFETCH(qreal, velocity);
+    QFETCH(TriggerSpeed, speed);
+
+    const auto delta = velocity * interval / 10000;
+    TriggerSpeed actualSpeed{};
+    std::chrono::microseconds timestamp{};
+    while (!m_handler->determineSpeed(TriggerType::Swipe, delta, timestamp, actualSpeed)) {
+        timestamp += std::chrono::microseconds(interval);
+        QVERIFY(timestamp <= 40ms);
+    }
+
+    QCOMPARE(actualSpeed, speed);
+}
+
+void TestMotionTriggerHandler::determineSpeed_perEventThreshold_data()
+{
+    QTest::addColumn<qint64>("interval");
+    QTest::addColumn<qreal>("delta");
+    QTest::addColumn<TriggerSpeed>("speed");
+
+    QTest::newRow("100 Hz, slow") << static_cast<qint64>(10000) << 15.0 << TriggerSpeed::Slow;
+    QTest::newRow("100 Hz, fast") << static_cast<qint64>(10000) << 25.0 << TriggerSpeed::Fast;
+    QTest::newRow("500 Hz, slow") << static_cast<qint64>(2000) << 15.0 << TriggerSpeed::Slow;
+    QTest::newRow("500 Hz, fast") << static_cast<qint64>(2000) << 25.0 << TriggerSpeed::Fast;
+}
+
+void TestMotionTriggerHandler::determineSpeed_perEventThreshold()
+{
+    QFETCH(qint64, interval);
+    QFETCH(qreal, delta);
+    QFETCH(TriggerSpeed, speed);
+
+    m_handler->setSpeedThresholdPerEvent(TriggerType::Swipe, 20);
+    TriggerSpeed actualSpeed{};
+    std::chrono::microseconds timestamp{};
+    while (!m_handler->determineSpeed(TriggerType::Swipe, delta, timestamp, actualSpeed)) {
+        timestamp += std::chrono::microseconds(interval);
+        QVERIFY(timestamp <= 40ms);
+    }
+
+    QCOMPARE(actualSpeed, speed);
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestMotionTriggerHandler)
+#include "TestMotionTriggerHandler.moc"
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <libinputactions/handlers/MotionTriggerHandler.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestableMotionTriggerHandler : public MotionTriggerHandler
+{
+public:
+    using MotionTriggerHandler::determineSpeed;
+    using MotionTriggerHandler::triggerActivating;
+};
+
+class TestMotionTriggerHandler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void determineSpeed_fastMotion_determinedBeforeWindowEnds();
+    void determineSpeed_slowMotion_determinedAfterWindow();
+
+    void determineSpeed_eventRate_data();
+    void determineSpeed_eventRate();
+
+    void determineSpeed_perEventThreshold_data();
+    void determineSpeed_perEventThreshold();
+
+private:
+    std::unique_ptr<TestableMotionTriggerHandler> m_handler;
+    std::unique_ptr<MotionTrigger> m_trigger;
+};
+
+}
\ No newline at end of file
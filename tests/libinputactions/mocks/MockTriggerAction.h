@@ -12,10 +12,10 @@ class MockTriggerAction : public TriggerAction
 public:
     MockTriggerAction() = default;
 
-    MOCK_METHOD(void, execute, (), (override));
+    MOCK_METHOD(void, execute, (uint32_t), (override));
     MOCK_METHOD(bool, canExecute, (), (const, override));
     MOCK_METHOD(const bool &, executed, (), (const, override));
-    MOCK_METHOD(void, tryExecute, (), (override));
+    MOCK_METHOD(void, tryExecute, (uint32_t), (override));
 
     MOCK_METHOD(void, triggerStarted, (), (override));
     MOCK_METHOD(void, triggerUpdated, (qreal, const QPointF &), (override));
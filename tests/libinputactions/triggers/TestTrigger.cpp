@@ -99,7 +99,7 @@ void TestTrigger::update()
     if (threshold) {
         m_trigger->setThreshold(*threshold);
     }
-    EXPECT_CALL(*m_action, execute()).Times(testing::Exactly(actionExecuted ? 1 : 0));
+    EXPECT_CALL(*m_action, execute(1)).Times(testing::Exactly(actionExecuted ? 1 : 0));
 
     for (const auto &delta : deltas) {
         m_updateEvent->setDelta(delta);
@@ -0,0 +1,145 @@
+#include "TestVariableManager.h"
+
+namespace libinputactions
+{
+
+void TestVariableManager::observer_localVariable()
+{
+    VariableManager manager;
+    manager.registerLocalVariable<qreal>("test");
+    const auto variable = manager.getVariable<qreal>("test");
+
+    std::vector<QString> changed;
+    manager.addObserver([&changed](const auto &name, const auto *) {
+        changed.push_back(name);
+    });
+
+    variable->set(1);
+    variable->set(1);
+    variable->set(2);
+    QCOMPARE(changed, std::vector<QString>({"test", "test"}));
+}
+
+void TestVariableManager::observer_remoteVariable()
+{
+    VariableManager manager;
+    qreal value = 1;
+    manager.registerRemoteVariable<qreal>("test", [&value](auto &result) {
+        result = value;
+    });
+    const auto *variable = manager.getVariable("test");
+
+    uint32_t changes{};
+    manager.addObserver([&changes](const auto &, const auto *) {
+        changes++;
+    });
+
+    variable->version();
+    QCOMPARE(changes, 1u);
+    variable->version();
+    QCOMPARE(changes, 1u);
+
+    value = 2;
+    QCOMPARE(changes, 1u);
+    variable->version();
+    QCOMPARE(changes, 2u);
+}
+
+void TestVariableManager::removeObserver()
+{
+    VariableManager manager;
+    manager.registerLocalVariable<qreal>("test");
+    const auto variable = manager.getVariable<qreal>("test");
+
+    uint32_t changes{};
+    const auto id = manager.addObserver([&changes](const auto &, const auto *) {
+        changes++;
+    });
+    variable->set(1);
+    manager.removeObserver(id);
+    variable->set(2);
+    QCOMPARE(changes, 1u);
+}
+
+void TestVariableManager::pointComponentVariable()
+{
+    VariableManager manager;
+    const auto point = manager.getVariable(BuiltinVariables::ThumbPositionPercentage);
+    const auto *x = manager.getVariable(BuiltinVariables::ThumbPositionPercentage.name + "_x");
+    const auto *y = manager.getVariable(BuiltinVariables::ThumbPositionPercentage.name + "_y");
+    QVERIFY(!x->get().has_value());
+
+    point->set(QPointF(1, 2));
+    QCOMPARE(std::any_cast<qreal>(x->get()), 1.0);
+    QCOMPARE(std::any_cast<qreal>(y->get()), 2.0);
+
+    const auto xVersion = x->version();
+    const auto yVersion = y->version();
+    point->set(QPointF(1, 3));
+    QCOMPARE(x->version(), xVersion);
+    QVERIFY(y->version() != yVersion);
+}
+
+void TestVariableManager::usageAnalysis()
+{
+    VariableManager manager;
+    const auto *deviceName = manager.getVariable(BuiltinVariables::DeviceName.name);
+    const auto *fingers = manager.getVariable(BuiltinVariables::Fingers.name);
+    const auto *thumbPosition = manager.getVariable(BuiltinVariables::ThumbPositionPercentage.name);
+    QVERIFY(deviceName->used());
+
+    manager.beginUsageAnalysis();
+    manager.markUsed(BuiltinVariables::Fingers);
+    manager.markUsed(BuiltinVariables::ThumbPositionPercentage.name + "_x");
+    manager.endUsageAnalysis(true);
+
+    QVERIFY(!deviceName->used());
+    QVERIFY(fingers->used());
+    QVERIFY(thumbPosition->used());
+}
+
+void TestVariableManager::usageAnalysis_notApplied()
+{
+    VariableManager manager;
+    const auto *deviceName = manager.getVariable(BuiltinVariables::DeviceName.name);
+
+    manager.beginUsageAnalysis();
+    manager.endUsageAnalysis(false);
+    QVERIFY(deviceName->used());
+
+    manager.markUsed(BuiltinVariables::Fingers);
+    manager.endUsageAnalysis(true);
+    QVERIFY(deviceName->used());
+}
+
+void TestVariableManager::usageAnalysis_watched()
+{
+    VariableManager manager;
+    const auto *deviceName = manager.getVariable(BuiltinVariables::DeviceName.name);
+    const auto *thumbPosition = manager.getVariable(BuiltinVariables::ThumbPositionPercentage.name);
+
+    manager.beginUsageAnalysis();
+    manager.endUsageAnalysis(true);
+    QVERIFY(!deviceName->used());
+
+    manager.watch(BuiltinVariables::DeviceName);
+    manager.watch(BuiltinVariables::DeviceName);
+    manager.watch(BuiltinVariables::ThumbPositionPercentage.name + "_x");
+    QVERIFY(deviceName->used());
+    QVERIFY(thumbPosition->used());
+
+    manager.unwatch(BuiltinVariables::DeviceName);
+    QVERIFY(deviceName->used());
+    manager.unwatch(BuiltinVariables::DeviceName);
+    QVERIFY(!deviceName->used());
+
+    // Watches are kept across configuration reloads
+    manager.beginUsageAnalysis();
+    manager.endUsageAnalysis(true);
+    QVERIFY(thumbPosition->used());
+}
+
+}
+
+QTEST_MAIN(libinputactions::TestVariableManager)
+#include "TestVariableManager.moc"
\ No newline at end of file
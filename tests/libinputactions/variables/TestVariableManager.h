@@ -0,0 +1,26 @@
+#pragma once
+
+#include <libinputactions/variables/VariableManager.h>
+
+#include <QTest>
+
+namespace libinputactions
+{
+
+class TestVariableManager : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void observer_localVariable();
+    void observer_remoteVariable();
+    void removeObserver();
+
+    void pointComponentVariable();
+
+    void usageAnalysis();
+    void usageAnalysis_notApplied();
+    void usageAnalysis_watched();
+};
+
+}
\ No newline at end of file